@@ -28,13 +28,64 @@
  */
 
 #include <memory>
-#include <queue>
+
+#include <EFLatencyHistogram.h>
+#include <EFScheduler.h>
 
 #include "FSMEvent.h"
+#include "FSMEventQueue.h"
 #include "FSMGlobals.h"
 #include "FSMState.h"
 
+/**
+ * @brief Interval in milliseconds over which the FSM reports the number of
+ * run() calls saved by stretching tick rates
+ */
+#define FSM_FRAMES_SAVED_WINDOW_MS 60000
+
+/**
+ * @brief Time in milliseconds dirtied globals are held back before they are
+ * written to NVS. Coalesces bursts of changes, e.g. while stepping through
+ * brightness levels, into a single flash write.
+ */
+#define FSM_PERSIST_DELAY_MS 2000
+
+/**
+ * @brief Maximum number of events waiting for their reaction to reach the LEDs.
+ * If more events are processed in between two frames, the oldest is discarded.
+ */
+#define FSM_LATENCY_PENDING_MAX 4
+
+/**
+ * @brief Time in microseconds after which an event whose reaction did not
+ * reach the LEDs is no longer tracked
+ */
+#define FSM_LATENCY_PHOTON_TIMEOUT_US 1000000
+
+/**
+ * @brief Stages of the input pipeline whose latency is tracked per FSMEvent.
+ * All stages are measured from the time the event was raised, e.g. by the
+ * touch ISR.
+ */
+enum class FSMLatencyStage {
+    Dequeue,  //!< Until the FSM took the event from the queue
+    Handler,  //!< Until the state's event handler and a resulting transition returned
+    Photon,   //!< Until the first LED frame submitted afterwards was completely sent
+};
+
+/**
+ * @brief Number of distinct FSMLatencyStages
+ */
+#define FSM_NUM_LATENCY_STAGES 3
 
+/**
+ * @brief An event whose reaction is still on its way to the LEDs
+ */
+struct FSMPendingPhoton {
+    FSMEvent event;             //!< The processed event
+    uint32_t raised_us;         //!< Time the event was raised at
+    uint32_t frames_submitted;  //!< Number of frames submitted to the LED output when the event was dequeued
+};
 /**
  * @brief Main finite state machine (FSM)
  */
@@ -43,11 +94,25 @@ class FSM {
     protected:
 
         unsigned int tickrate_ms;         //!< Amount of milliseconds this FSM whishes to be handle()'ed
-        unsigned int state_last_run;      //!< Timestamp of the last execution of the current states run() method
+        unsigned int state_last_run;      //!< Scheduled time of the last execution of the current states run() method
+        unsigned int tick_show_count;     //!< Number of LED strip pushes during the last handle() cycle
+        unsigned int tick_show_count_max; //!< Highest number of LED strip pushes during a single handle() cycle
 
-        std::unique_ptr<FSMState> state;     //!< Current FSM state
-        std::queue<FSMEvent> eventqueue;     //!< Queue to store FSMEvents. ATTENTION: THIS IS NOT THREAD SAFE ON ITS OWN!
+        unsigned int state_interval_ms;        //!< Current, possibly stretched, interval between run() calls of the current state
+        uint32_t frames_saved;                 //!< Number of run() calls saved by stretched intervals since boot
+        uint32_t frames_saved_window_start;    //!< Value of frames_saved at the start of the current report window
+        uint32_t frames_saved_window_start_ms; //!< Timestamp the current report window started at
+        uint32_t frames_saved_per_minute;      //!< Number of run() calls saved during the last full report window
+
+        FSMStatePtr state;                   //!< Current FSM state, stored inside the FSMStateArena
+        FSMEventQueue eventqueue;            //!< Queue to store FSMEvents. Single producer, single consumer.
+        uint32_t events_dropped_reported;    //!< Number of dropped events already reported via log
         std::shared_ptr<FSMGlobals> globals; //!< Global FSM state data
+        EFSchedulerJobId job_persist;        //!< Deferred write of dirtied globals to NVS
+
+        EFLatencyHistogram latency[FSM_NUM_EVENTS][FSM_NUM_LATENCY_STAGES]; //!< Input latencies per event and stage
+        FSMPendingPhoton latency_pending[FSM_LATENCY_PENDING_MAX];          //!< Events waiting for their reaction to be shown, oldest first
+        uint8_t latency_pending_num;                                         //!< Number of valid entries in latency_pending
 
         const char* NVS_NAMESPACE = "effsm";  //!< Namespace under which the FSM stores persisted data in non-volatile storage (NVS)
 
@@ -56,7 +121,38 @@ class FSM {
          * 
          * @return Next FSMEvent or FSMEvent::NoOp if no events exist
          */
-        FSMEvent dequeueEvent();
+        FSMTimedEvent dequeueEvent();
+
+        /**
+         * @brief Records the photon latency of all pending events whose
+         * reaction was completely sent to the LEDs since the last call
+         */
+        void trackPhotonLatency();
+
+        /**
+         * @brief Executes the run() method of the current state, if it is due.
+         * All LED changes made by run() are pushed to the strip as a single frame.
+         *
+         * Runs are phase-locked to whole intervals, so a late handle() does not
+         * shift the following runs. If more than one interval was missed, the
+         * missed runs are skipped instead of caught up.
+         *
+         * If the frame differs imperceptibly from the one before, the interval
+         * to the next run() is doubled, up to the states getMaxTickRateMs().
+         * A visible change halves it again, an event or a transition resets it
+         * to getTickRateMs().
+         */
+        void runState();
+
+        /**
+         * @brief Processes up to num_events events from the queue and performs
+         * state transitions requested by the current state. All LED changes made
+         * by an event handler and the exit() and entry() of a resulting
+         * transition are pushed to the strip as a single frame.
+         *
+         * @param num_events Maximum number of events from the queue to process
+         */
+        void processEvents(unsigned int num_events);
 
     public:
 
@@ -82,7 +178,7 @@ class FSM {
          * 
          * @param next The state to transition to.
          */
-        void transition(std::unique_ptr<FSMState> next);
+        void transition(FSMStatePtr next);
 
         /**
          * @brief Retrieves the tick rate of this FSM
@@ -92,10 +188,32 @@ class FSM {
         unsigned int getTickRateMs();
 
         /**
-         * @brief Enqueues the given event to be handled during the next cycle
+         * @brief Retrieves the time until the FSM has work to do again, i.e.
+         * until the current state's run() is due. Allows to sleep in between
+         * handle() calls instead of polling at the tick rate. Queued events
+         * are not considered and should trigger handle() right away.
+         *
+         * @return Milliseconds until handle() should be called next
+         */
+        unsigned int getMsUntilNextRun();
+
+        /**
+         * @brief Enqueues the given event to be handled during the next cycle.
+         * Lock-free and safe to call from an ISR, as long as all events are
+         * queued from the same context. Drops the event if the queue is full.
          */
         void queueEvent(FSMEvent event);
 
+        /**
+         * @brief Enqueues the given event, which was raised at the given time.
+         * Allows to account for the time between the actual input, e.g. a
+         * touch ISR, and queueing the event.
+         *
+         * @param event Event to enqueue
+         * @param timestamp_us Time the event was raised at, as returned by micros()
+         */
+        void queueEvent(FSMEvent event, uint32_t timestamp_us);
+
         /**
          * @brief Retrieves the number of FSMEvents currently waiting to be processed
          * 
@@ -103,6 +221,21 @@ class FSM {
          */
         unsigned int getQueueSize();
 
+        /**
+         * @brief Retrieves the number of events dropped since boot because
+         * the queue was full
+         *
+         * @return Number of dropped FSMEvents
+         */
+        uint32_t getDroppedEventCount();
+
+        /**
+         * @brief Retrieves how often the event queue ran full since boot
+         *
+         * @return Number of queue overflows
+         */
+        uint32_t getEventOverflowCount();
+
         /**
          * @brief Execute a processing cycle. Processes all events that are currently queued.
          */
@@ -116,11 +249,54 @@ class FSM {
          */
         void handle(unsigned int num_events);
 
+        /**
+         * @brief Retrieves the number of times the LED strip was pushed during
+         * the last processing cycle
+         *
+         * @return Number of frames pushed during the last handle()
+         */
+        unsigned int getShowCountLastTick();
+
+        /**
+         * @brief Retrieves the highest number of times the LED strip was pushed
+         * during a single processing cycle since boot
+         *
+         * @return Maximum number of frames pushed during a single handle()
+         */
+        unsigned int getShowCountMaxTick();
+
+        /**
+         * @brief Retrieves the number of run() calls that were saved during the
+         * last minute because the state's output did not visibly change
+         *
+         * @return Frames saved during the last full minute
+         */
+        uint32_t getFramesSavedPerMinute();
+
+        /**
+         * @brief Retrieves the latency histogram of the given event and stage
+         *
+         * @param event Event to retrieve latencies for
+         * @param stage Pipeline stage to retrieve latencies for
+         * @return Histogram of latencies in microseconds since the event was raised
+         */
+        const EFLatencyHistogram& getLatencyHistogram(FSMEvent event, FSMLatencyStage stage);
+
+        /**
+         * @brief Logs p50, p99 and max latencies of all events seen since boot
+         */
+        void logLatencyReport();
+
         /**
          * @brief Presists the current globals state of this FSM to the NVS partition
          */
         void persistGlobals();
 
+        /**
+         * @brief Immediately persists globals whose deferred write is still pending
+         */
+        void flushGlobals();
+
         /**
          * @brief Loads the globals state from the NVS partition and recovers it into current
          * globals FSM state
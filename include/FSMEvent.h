@@ -46,4 +46,9 @@ enum class FSMEvent {
     NoseLongpress,
 };
 
+/**
+ * @brief Number of distinct FSMEvents
+ */
+#define FSM_NUM_EVENTS 11
+
 #endif /* FSMEVENT_H_ */
\ No newline at end of file
@@ -0,0 +1,149 @@
+#ifndef FSMEVENTQUEUE_H_
+#define FSMEVENTQUEUE_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <atomic>
+#include <stdint.h>
+
+#include "FSMEvent.h"
+
+/**
+ * @brief Number of slots in the FSM event queue. Must be a power of two.
+ */
+#define FSM_EVENT_QUEUE_SIZE 32
+
+/**
+ * @brief FSMEvent together with the time it was raised at
+ */
+struct FSMTimedEvent {
+    FSMEvent event;         //!< The event
+    uint32_t timestamp_us;  //!< Time the event was raised at, in microseconds since boot
+};
+
+/**
+ * @brief Fixed-size, lock-free single-producer / single-consumer ring of
+ * FSMEvents
+ *
+ * Neither side allocates, blocks or masks interrupts, so events may be pushed
+ * from an ISR. All pushes must come from the same context, e.g. the touch ISR
+ * path or the main loop, and all pops from another single context. If the
+ * ring is full, the new event is dropped and counted.
+ *
+ * Methods are defined inline, so they can be called from IRAM code.
+ */
+class FSMEventQueue {
+
+    protected:
+
+        FSMTimedEvent slots[FSM_EVENT_QUEUE_SIZE];  //!< Event storage
+        std::atomic<uint32_t> head;                 //!< Number of events pushed. Written by the producer only.
+        std::atomic<uint32_t> tail;                 //!< Number of events popped. Written by the consumer only.
+        std::atomic<uint32_t> dropped;              //!< Number of events dropped because the ring was full
+        std::atomic<uint32_t> overflows;            //!< Number of times the ring ran full
+        bool overflowing;                           //!< True, while events are dropped. Used by the producer only.
+
+        static_assert((FSM_EVENT_QUEUE_SIZE & (FSM_EVENT_QUEUE_SIZE - 1)) == 0, "FSM_EVENT_QUEUE_SIZE must be a power of two");
+
+    public:
+
+        /**
+         * @brief Constructs a new, empty event queue
+         */
+        FSMEventQueue()
+        : slots()
+        , head(0)
+        , tail(0)
+        , dropped(0)
+        , overflows(0)
+        , overflowing(false)
+        {
+        }
+
+        /**
+         * @brief Appends an event. Producer side.
+         *
+         * @param event Event to append
+         * @param timestamp_us Time the event was raised at
+         * @return False, if the ring was full and the event was dropped
+         */
+        bool push(FSMEvent event, uint32_t timestamp_us) {
+            const uint32_t head = this->head.load(std::memory_order_relaxed);
+            if (head - this->tail.load(std::memory_order_acquire) >= FSM_EVENT_QUEUE_SIZE) {
+                this->dropped.fetch_add(1, std::memory_order_relaxed);
+                if (!this->overflowing) {
+                    this->overflowing = true;
+                    this->overflows.fetch_add(1, std::memory_order_relaxed);
+                }
+                return false;
+            }
+
+            this->slots[head % FSM_EVENT_QUEUE_SIZE] = {event, timestamp_us};
+            this->head.store(head + 1, std::memory_order_release);
+            this->overflowing = false;
+            return true;
+        }
+
+        /**
+         * @brief Removes the oldest event. Consumer side.
+         *
+         * @param out Receives the removed event
+         * @return False, if the ring was empty
+         */
+        bool pop(FSMTimedEvent& out) {
+            const uint32_t tail = this->tail.load(std::memory_order_relaxed);
+            if (tail == this->head.load(std::memory_order_acquire)) {
+                return false;
+            }
+
+            out = this->slots[tail % FSM_EVENT_QUEUE_SIZE];
+            this->tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Retrieves the number of queued events. Exact only when called
+         * from the producer or the consumer while the other side is idle.
+         */
+        uint32_t size() const {
+            const uint32_t tail = this->tail.load(std::memory_order_acquire);
+            return this->head.load(std::memory_order_acquire) - tail;
+        }
+
+        /**
+         * @brief Retrieves the number of events dropped because the ring was full
+         */
+        uint32_t getDroppedCount() const {
+            return this->dropped.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Retrieves how often the ring ran full. Every overflow drops
+         * one or more consecutive events.
+         */
+        uint32_t getOverflowCount() const {
+            return this->overflows.load(std::memory_order_relaxed);
+        }
+};
+
+#endif /* FSMEVENTQUEUE_H_ */
@@ -50,6 +50,7 @@ typedef struct {
     uint8_t animMatrixIdx = 0;      //!< AnimateMatrix: Color selector
     
     uint8_t cstPatternsIdx = 0;      //!< CustomPatterns: Mode selector
+    uint8_t animPlaybackIdx = 0;     //!< AnimationPlayback: Animation selector
 	
 	uint8_t huemeshOwnHue = 0;	//!< GameHuemesh: Own hue smelector
 
@@ -27,10 +27,32 @@
  * @author Honigeintopf
  */
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <utility>
+
+#include <EFLed.h>
+#include <EFLedAnimation.h>
+#include <EFLedPalette.h>
 
 #include "FSMGlobals.h"
 
+class FSMState;
+
+/**
+ * @brief Destroys a state created by makeState() and returns its storage to
+ * the FSMStateArena
+ */
+struct FSMStateDeleter {
+    void operator()(FSMState* state) const;
+};
+
+/**
+ * @brief Owning pointer to an FSM state inside the FSMStateArena
+ */
+typedef std::unique_ptr<FSMState, FSMStateDeleter> FSMStatePtr;
+
 
 /**
  * @brief Base class for FSM states
@@ -44,6 +66,11 @@ class FSMState {
         bool is_locked;                       //!< True, if the state should be considered as locked
 
     public:
+        /**
+         * @brief Destructs this state. States are destroyed through FSMStatePtr.
+         */
+        virtual ~FSMState() = default;
+
         /**
          * @brief Sets the reference on the global FSM data struct
          */
@@ -107,13 +134,29 @@ class FSMState {
          */
         virtual const unsigned int getTickRateMs();
 
+        /**
+         * @brief Provides access to the longest tick rate this state tolerates
+         *
+         * While run() produces frames that differ imperceptibly from the one
+         * before, the FSM stretches the interval between two calls up to this
+         * value. Only states whose animations depend on the elapsed time
+         * rather than on the number of run() calls should return more than
+         * getTickRateMs(). Keep it well below the shortest step of the
+         * animation, e.g. a quarter, so the next visible change is not delayed.
+         *
+         * @return Maximum number of milliseconds between two calls to run().
+         * Defaults to getTickRateMs(), which disables stretching.
+         */
+        virtual const unsigned int getMaxTickRateMs();
+
         /**
          * @brief Executed on state entry 
          */
         virtual void entry();
 
         /**
-         * @brief Executed once every FSM tick
+         * @brief Executed once every FSM tick. All LED changes made during a
+         * single run() are pushed to the strip as one frame.
          */
         virtual void run();
 
@@ -125,73 +168,72 @@ class FSMState {
         /**
          * @brief Executed on FSMEvent::FingerprintTouch
          */
-        virtual std::unique_ptr<FSMState> touchEventFingerprintTouch();
+        virtual FSMStatePtr touchEventFingerprintTouch();
 
         /**
          * @brief Executed on FSMEvent::FingerprintRelease
          */
-        virtual std::unique_ptr<FSMState> touchEventFingerprintRelease();
+        virtual FSMStatePtr touchEventFingerprintRelease();
 
         /**
          * @brief Executed on FSMEvent::FingerprintShortpress
          */
-        virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress();
+        virtual FSMStatePtr touchEventFingerprintShortpress();
 
         /**
          * @brief Executed on FSMEvent::FingerprintLongpress
          */
-        virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress();
+        virtual FSMStatePtr touchEventFingerprintLongpress();
 
         /**
          * @brief Executed on FSMEvent::NoseTouch
          */
-        virtual std::unique_ptr<FSMState> touchEventNoseTouch();
+        virtual FSMStatePtr touchEventNoseTouch();
 
         /**
          * @brief Executed on FSMEvent::NoseRelease
          */
-        virtual std::unique_ptr<FSMState> touchEventNoseRelease();
+        virtual FSMStatePtr touchEventNoseRelease();
 
         /**
          * @brief Executed on FSMEvent::NoseShortpress
          */
-        virtual std::unique_ptr<FSMState> touchEventNoseShortpress();
+        virtual FSMStatePtr touchEventNoseShortpress();
 
         /**
          * @brief Executed on FSMEvent::NoseLongpress
          */
-        virtual std::unique_ptr<FSMState> touchEventNoseLongpress();
+        virtual FSMStatePtr touchEventNoseLongpress();
 
         /**
          * @brief Executed on FSMEvent::AllShortpress
          */
-        virtual std::unique_ptr<FSMState> touchEventAllShortpress();
+        virtual FSMStatePtr touchEventAllShortpress();
 
         /**
          * @brief Executed on FSMEvent::AllLongpress
          */
-        virtual std::unique_ptr<FSMState> touchEventAllLongpress();
+        virtual FSMStatePtr touchEventAllLongpress();
 };
 
 /**
  * @brief Displays pride flags
  */
 struct DisplayPrideFlag : public FSMState {
-    uint32_t tick = 0;
-    uint8_t flagidx = 0;
-    unsigned int switchdelay_ms = 5000;
+    uint32_t start_ms = 0;  //!< Timestamp the current flag animation started at
 
     virtual const char* getName() override;
     virtual bool shouldBeRemembered() override;
     virtual const unsigned int getTickRateMs() override;
+    virtual const unsigned int getMaxTickRateMs() override;
 
     virtual void entry() override;
     virtual void run() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 };
 
 /**
@@ -206,11 +248,12 @@ struct AnimateRainbow : public FSMState {
 
     virtual void entry() override;
     virtual void run() override;
+    virtual void exit() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 
     void _animateRainbow();
     void _animateRainbowCircle();
@@ -229,10 +272,10 @@ struct AnimateMatrix : public FSMState {
     virtual void entry() override;
     virtual void run() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 };
 
 /**
@@ -240,6 +283,7 @@ struct AnimateMatrix : public FSMState {
  */
 struct AnimateSnake : public FSMState {
     uint32_t tick = 0;
+    const EFLedValueRamp* ramp = nullptr;  //!< Value ramp of the current hue
 
     virtual const char* getName() override;
     virtual bool shouldBeRemembered() override;
@@ -248,10 +292,10 @@ struct AnimateSnake : public FSMState {
     virtual void entry() override;
     virtual void run() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 
     void _animateSnake();
     void _animateKnightRider();
@@ -266,6 +310,7 @@ struct AnimateSnake : public FSMState {
  */
 struct AnimateHeartbeat : public FSMState {
     uint32_t tick = 0;
+    const EFLedValueRamp* ramp = nullptr;  //!< Value ramp of the current hue
 
     virtual const char* getName() override;
     virtual bool shouldBeRemembered() override;
@@ -274,11 +319,11 @@ struct AnimateHeartbeat : public FSMState {
     virtual void entry() override;
     virtual void run() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventNoseRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventNoseShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventNoseRelease() override;
+    virtual FSMStatePtr touchEventNoseShortpress() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 };
 
 /**
@@ -291,8 +336,8 @@ struct OTAUpdate : public FSMState {
     virtual void run() override;
     virtual void exit() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
 };
 
 /**
@@ -308,13 +353,13 @@ struct GameHuemesh : public FSMState {
     virtual void run() override;
 	virtual void exit() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-	virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-	virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-	virtual std::unique_ptr<FSMState> touchEventNoseShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventNoseLongpress() override;
-	virtual std::unique_ptr<FSMState> touchEventNoseRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+	virtual FSMStatePtr touchEventFingerprintLongpress() override;
+	virtual FSMStatePtr touchEventFingerprintRelease() override;
+	virtual FSMStatePtr touchEventNoseShortpress() override;
+    virtual FSMStatePtr touchEventNoseLongpress() override;
+	virtual FSMStatePtr touchEventNoseRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 };
 
 
@@ -323,6 +368,8 @@ struct GameHuemesh : public FSMState {
  */
 struct VUMeter : public FSMState {
     uint32_t tick = 0;
+    const EFLedValueRamp* dragon_ramp = nullptr;  //!< Value ramp of the dragon hue
+    const EFLedValueRamp* bar_ramp = nullptr;     //!< Value ramp of the EF bar hue
 
     virtual const char* getName() override;
     virtual bool shouldBeRemembered() override;
@@ -330,10 +377,10 @@ struct VUMeter : public FSMState {
     virtual void entry() override;
     virtual void run() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 };
 
 /**
@@ -350,10 +397,10 @@ struct MenuMain : public FSMState {
     virtual void run() override;
     virtual void exit() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventNoseLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventNoseLongpress() override;
 };
 
 /**
@@ -361,25 +408,133 @@ struct MenuMain : public FSMState {
  */
 struct CustomPatternsDisplay : public FSMState {
     uint32_t tick = 0;
-    unsigned int switchdelay_ms = 5000;
+    uint32_t start_ms = 0;  //!< Timestamp the current timeline started at
+    uint32_t seed = 0;
 
     virtual const char* getName() override;
     virtual bool shouldBeRemembered() override;
     virtual const unsigned int getTickRateMs() override;
+    virtual const unsigned int getMaxTickRateMs() override;
 
     virtual void entry() override;
     virtual void run() override;
 
-    virtual std::unique_ptr<FSMState> touchEventFingerprintLongpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintShortpress() override;
-    virtual std::unique_ptr<FSMState> touchEventFingerprintRelease() override;
-    virtual std::unique_ptr<FSMState> touchEventAllLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
 
-    void _staticPattern();
-    void _rotatingDragonHead();
-    void _rotatingFull();
     void _starlight();
-    void _randomPattern();
 };
 
-#endif /* FSM_STATE_H_ */
\ No newline at end of file
+/**
+ * @brief Plays animations from the animation flash partition
+ */
+struct AnimationPlayback : public FSMState {
+    EFLedAnimation animation;        //!< Animation currently played
+    CRGB frame[EFLED_TOTAL_NUM];     //!< Last decoded frame
+
+    virtual const char* getName() override;
+    virtual bool shouldBeRemembered() override;
+    virtual const unsigned int getTickRateMs() override;
+
+    virtual void entry() override;
+    virtual void run() override;
+
+    virtual FSMStatePtr touchEventFingerprintLongpress() override;
+    virtual FSMStatePtr touchEventFingerprintShortpress() override;
+    virtual FSMStatePtr touchEventFingerprintRelease() override;
+    virtual FSMStatePtr touchEventAllLongpress() override;
+
+    void _load();
+};
+
+/**
+ * @brief Number of states that can exist at the same time: the current state
+ * and the next state returned by one of its event handlers
+ */
+#define FSM_STATE_ARENA_SLOTS 2
+
+/**
+ * @brief Retrieves the size of the largest of the given types
+ */
+template<typename... T>
+constexpr size_t fsmMaxSizeOf() {
+    size_t size = 0;
+    ((size = sizeof(T) > size ? sizeof(T) : size), ...);
+    return size;
+}
+
+/**
+ * @brief Statically allocated storage for FSM states
+ *
+ * Each slot is large enough to hold any state, so transitions construct the
+ * next state in place instead of allocating it on the heap. Use makeState()
+ * to create states.
+ */
+class FSMStateArena {
+
+    public:
+
+        /**
+         * @brief Alignment of each slot
+         */
+        static constexpr size_t SLOT_ALIGN = alignof(std::max_align_t);
+
+        /**
+         * @brief Size of a single slot. Fits every state listed here.
+         */
+        static constexpr size_t SLOT_SIZE = (fsmMaxSizeOf<
+            DisplayPrideFlag,
+            AnimateRainbow,
+            AnimateMatrix,
+            AnimateSnake,
+            AnimateHeartbeat,
+            OTAUpdate,
+            GameHuemesh,
+            VUMeter,
+            MenuMain,
+            CustomPatternsDisplay,
+            AnimationPlayback
+        >() + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+
+        /**
+         * @brief Reserves a free slot
+         *
+         * @return Storage of SLOT_SIZE bytes or nullptr, if all slots are in use
+         */
+        static void* acquire();
+
+        /**
+         * @brief Returns a slot previously reserved via acquire()
+         *
+         * @param slot Storage to return
+         */
+        static void release(void* slot);
+
+        /**
+         * @brief Retrieves the number of slots currently in use
+         *
+         * @return Number of existing states
+         */
+        static uint8_t getUsedSlots();
+};
+
+/**
+ * @brief Creates a new state inside the FSMStateArena. Never touches the heap.
+ *
+ * @return The new state or nullptr, if all arena slots are in use
+ */
+template<typename T, typename... Args>
+FSMStatePtr makeState(Args&&... args) {
+    static_assert(sizeof(T) <= FSMStateArena::SLOT_SIZE, "State does not fit into FSMStateArena. Add it to SLOT_SIZE.");
+    static_assert(alignof(T) <= FSMStateArena::SLOT_ALIGN, "State requires a stricter alignment than FSMStateArena provides");
+
+    void* slot = FSMStateArena::acquire();
+    if (slot == nullptr) {
+        return FSMStatePtr(nullptr);
+    }
+    return FSMStatePtr(new (slot) T(std::forward<Args>(args)...));
+}
+
+#endif /* FSM_STATE_H_ */
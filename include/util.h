@@ -30,8 +30,11 @@
 #include <EFBoardPowerState.h>
 #include <EFTouchZone.h>
 
+#include "FSMEvent.h"
+
 const char* toString(EFBoardPowerState state);
 const char* toString(EFTouchZone zone);
-const float wave_function(float x, float start, float end, float amplitude);
+const char* toString(FSMEvent event);
+const uint8_t wave_function(int16_t x, int16_t start, int16_t end, uint8_t amplitude);
 
 #endif /* UTIL_H_ */
\ No newline at end of file
@@ -28,6 +28,7 @@
 #include <ArduinoOTA.h>
 #include <WiFi.h>
 
+#include <EFEnergy.h>
 #include <EFLed.h>
 #include <EFLogging.h>
 
@@ -38,7 +39,10 @@ RTC_DATA_ATTR uint32_t bootCount = 0;
 volatile int8_t ota_last_progress = -1;
 
 EFBoardClass::EFBoardClass()
-    : power_state(EFBoardPowerState::UNKNOWN) {
+    : power_state(EFBoardPowerState::UNKNOWN)
+    , light_sleep_enabled(false)
+    , pm_lock_usb(nullptr)
+    , pm_lock_usb_held(false) {
     bootCount++;
 }
 
@@ -201,6 +205,7 @@ const EFBoardPowerState EFBoardClass::updatePowerState() {
         }
     }
 
+    this->updateUsbSleepLock();
     return this->power_state;
 }
 
@@ -213,10 +218,78 @@ const EFBoardPowerState EFBoardClass::resetPowerState() {
     return this->updatePowerState();
 }
 
+bool EFBoardClass::enableAutoLightSleep() {
+    if (this->pm_lock_usb == nullptr) {
+        const esp_err_t err = esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "efboard_usb", &this->pm_lock_usb);
+        if (err != ESP_OK) {
+            LOGF_WARNING(
+                "(EFBoard) Power management unavailable (%s). Build with CONFIG_PM_ENABLE, e.g. env esp32-s3-devkitc-1-lightsleep. Staying awake.\r\n",
+                esp_err_to_name(err)
+            );
+            return false;
+        }
+        this->updateUsbSleepLock();
+    }
+
+    // Touch interrupts must be able to wake the chip
+    esp_sleep_enable_touchpad_wakeup();
+
+    esp_pm_config_esp32s3_t config = {
+        .max_freq_mhz = (int) getCpuFrequencyMhz(),
+        .min_freq_mhz = (int) getXtalFrequencyMhz(),
+        .light_sleep_enable = true
+    };
+    esp_err_t err = esp_pm_configure(&config);
+    if (err != ESP_OK) {
+        LOGF_WARNING(
+            "(EFBoard) Automatic light sleep unavailable (%s). Build with CONFIG_FREERTOS_USE_TICKLESS_IDLE, e.g. env esp32-s3-devkitc-1-lightsleep.\r\n",
+            esp_err_to_name(err)
+        );
+
+        // Frequency scaling alone still helps
+        config.light_sleep_enable = false;
+        err = esp_pm_configure(&config);
+    }
+    if (err != ESP_OK) {
+        LOGF_WARNING("(EFBoard) Failed to configure power management: %s\r\n", esp_err_to_name(err));
+        return false;
+    }
+
+    this->light_sleep_enabled = config.light_sleep_enable;
+    LOGF_INFO(
+        "(EFBoard) Power management: %d - %d MHz, automatic light sleep %s\r\n",
+        config.min_freq_mhz,
+        config.max_freq_mhz,
+        this->light_sleep_enabled ? "enabled" : "disabled"
+    );
+    return this->light_sleep_enabled;
+}
+
+bool EFBoardClass::isAutoLightSleepEnabled() {
+    return this->light_sleep_enabled;
+}
+
+void EFBoardClass::updateUsbSleepLock() {
+    if (this->pm_lock_usb == nullptr) {
+        return;
+    }
+
+    const bool usb = this->power_state == EFBoardPowerState::USB;
+    if (usb && !this->pm_lock_usb_held) {
+        esp_pm_lock_acquire(this->pm_lock_usb);
+        LOG_DEBUG("(EFBoard) USB powered, light sleep blocked");
+    } else if (!usb && this->pm_lock_usb_held) {
+        esp_pm_lock_release(this->pm_lock_usb);
+        LOG_DEBUG("(EFBoard) Battery powered, light sleep allowed");
+    }
+    this->pm_lock_usb_held = usb;
+}
+
 bool EFBoardClass::connectToWifi(const char *ssid, const char *password) {
     LOGF_INFO("(EFBoard) Connecting to WiFi network: %s ", ssid);
 
     // Try to connect to WiFi
+    EFEnergy.setRadioActive(true);
     WiFi.begin(ssid, password);
     WiFi.setSleep(true);
     for (int32_t timeout_ms = 10000; timeout_ms >= 0; timeout_ms -= 200) {
@@ -255,6 +328,7 @@ bool EFBoardClass::disableWifi() {
         return false;
     }
 
+    EFEnergy.setRadioActive(false);
     LOG_INFO("(EFBoard) Disabled WiFi");
     return true;
 }
@@ -281,6 +355,7 @@ void EFBoardClass::enableOTA(const char *password) {
                 ota_last_progress = -1;
 
                 // Setup LEDs
+                EFLedFrameGuard frame(EFLed);
                 EFLed.clear();
                 EFLed.setBrightnessPercent(50);
                 EFLed.setDragonEye(CRGB::Blue);
@@ -305,6 +380,7 @@ void EFBoardClass::enableOTA(const char *password) {
             })
             .onError([](ota_error_t error) {
                 LOGF_ERROR("(OTA) Error[%u]: ", error);
+                EFLedFrameGuard frame(EFLed);
                 EFLed.setDragonNose(CRGB::Red);
                 if (error == OTA_AUTH_ERROR) {
                     LOG_WARNING("(OTA) Auth Failed");
@@ -27,6 +27,8 @@
  * @author Honigeintopf
  */
 
+#include <esp_pm.h>
+
 #include "EFBoardPowerState.h"
 
 #define EFBOARD_FIRMWARE_VERSION "v2024.09.07"
@@ -52,6 +54,16 @@ class EFBoardClass {
 
         EFBoardPowerState power_state;  //!< Power state of the board during the last check 
 
+        bool light_sleep_enabled;            //!< True, if the chip enters light sleep automatically while idle
+        esp_pm_lock_handle_t pm_lock_usb;    //!< Keeps the chip out of light sleep while USB serial is connected
+        bool pm_lock_usb_held;               //!< True, if pm_lock_usb is currently acquired
+
+        /**
+         * @brief Keeps the chip awake while powered from USB, since the USB
+         * serial connection does not survive light sleep
+         */
+        void updateUsbSleepLock();
+
     public:
 
         /**
@@ -125,6 +137,30 @@ class EFBoardClass {
          */
         const EFBoardPowerState resetPowerState();
 
+        /**
+         * @brief Configures power management to scale the CPU frequency and to
+         * enter light sleep automatically whenever all tasks are blocked. Touch
+         * interrupts and FreeRTOS timeouts wake the chip up again.
+         *
+         * Light sleep is prevented while LED frames are sent and while the
+         * board is powered from USB, to keep serial logging alive.
+         *
+         * Requires an ESP-IDF built with CONFIG_PM_ENABLE and
+         * CONFIG_FREERTOS_USE_TICKLESS_IDLE, which the stock Arduino framework
+         * lacks. See the esp32-s3-devkitc-1-lightsleep environment.
+         *
+         * @return True, if automatic light sleep is active. False, if the
+         * framework was built without support for it.
+         */
+        bool enableAutoLightSleep();
+
+        /**
+         * @brief Determines if the chip enters light sleep automatically
+         *
+         * @return True, if automatic light sleep is active
+         */
+        bool isAutoLightSleepEnabled();
+
         /**
          * @brief Tries to connect to the given WiFi access point
          * 
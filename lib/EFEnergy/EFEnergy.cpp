@@ -0,0 +1,282 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <string.h>
+
+#include <Arduino.h>
+#include <EFLogging.h>
+
+#ifdef ESP_PLATFORM
+#include <Preferences.h>
+#include <esp_pm.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+#include "EFEnergy.h"
+
+/**
+ * @brief Number of uA*ms in a mAh
+ */
+#define EFENERGY_UAMS_PER_MAH 3600000000.0f
+
+EFEnergyClass::EFEnergyClass()
+: accounts()
+, num_accounts(0)
+, active_account(0)
+, radio_active(false)
+, current_ua(0)
+, idle_percent(0)
+, last_idle_runtime()
+, last_update_us(0)
+, boot_charge_uams(0)
+, last_update_ms(0)
+, last_persist_ms(0)
+{
+}
+
+void EFEnergyClass::begin() {
+#ifdef ESP_PLATFORM
+    Preferences pref;
+    pref.begin(this->NVS_NAMESPACE, true);
+    const uint8_t num = pref.getUChar("num", 0);
+    // Discard data written with a different account layout
+    if (
+        num <= EFENERGY_MAX_ACCOUNTS &&
+        pref.getUShort("layout", 0) == sizeof(EFEnergyAccount) &&
+        pref.getBytesLength("accounts") == num * sizeof(EFEnergyAccount)
+    ) {
+        pref.getBytes("accounts", this->accounts, num * sizeof(EFEnergyAccount));
+        this->num_accounts = num;
+    }
+    pref.end();
+#endif
+
+    this->last_update_ms = millis();
+    this->last_persist_ms = millis();
+    this->measureIdlePercent();
+    LOGF_INFO("(EFEnergy) Restored %d accounts\r\n", this->num_accounts);
+}
+
+int EFEnergyClass::findAccount(const char* name) const {
+    for (uint8_t i = 0; i < this->num_accounts; i++) {
+        if (strncmp(this->accounts[i].name, name, EFENERGY_NAME_LEN - 1) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void EFEnergyClass::setAccount(const char* name) {
+    const int idx = this->findAccount(name);
+    if (idx >= 0) {
+        this->active_account = idx;
+        return;
+    }
+
+    // The last slot is reserved for everything else
+    if (this->num_accounts >= EFENERGY_MAX_ACCOUNTS - 1) {
+        LOGF_WARNING("(EFEnergy) No account left for %s, charging %s\r\n", name, EFENERGY_OTHER_ACCOUNT);
+        this->setOtherAccount();
+        return;
+    }
+
+    EFEnergyAccount& account = this->accounts[this->num_accounts];
+    strncpy(account.name, name, EFENERGY_NAME_LEN - 1);
+    account.name[EFENERGY_NAME_LEN - 1] = '\0';
+    account.charge_uams = 0;
+    account.active_ms = 0;
+    this->active_account = this->num_accounts++;
+}
+
+void EFEnergyClass::setOtherAccount() {
+    const int idx = this->findAccount(EFENERGY_OTHER_ACCOUNT);
+    if (idx >= 0) {
+        this->active_account = idx;
+        return;
+    }
+
+    EFEnergyAccount* account;
+    if (this->num_accounts == EFENERGY_MAX_ACCOUNTS) {
+        // Accounts restored from older firmware may occupy all slots. The
+        // last one becomes the other account and keeps its charge.
+        account = &this->accounts[EFENERGY_MAX_ACCOUNTS - 1];
+    } else {
+        account = &this->accounts[this->num_accounts++];
+        account->charge_uams = 0;
+        account->active_ms = 0;
+    }
+    strncpy(account->name, EFENERGY_OTHER_ACCOUNT, EFENERGY_NAME_LEN - 1);
+    account->name[EFENERGY_NAME_LEN - 1] = '\0';
+    this->active_account = account - this->accounts;
+}
+
+uint8_t EFEnergyClass::measureIdlePercent() {
+#if defined(ESP_PLATFORM) && defined(CONFIG_FREERTOS_USE_TRACE_FACILITY) && defined(CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS) && defined(CONFIG_FREERTOS_RUN_TIME_STATS_USING_ESP_TIMER)
+    const unsigned long now_us = micros();
+    const uint32_t elapsed_us = now_us - this->last_update_us;
+    this->last_update_us = now_us;
+
+    // The chip only sleeps while all cores are idle
+    uint8_t percent = 100;
+    for (uint8_t core = 0; core < portNUM_PROCESSORS && core < EFENERGY_MAX_CORES; core++) {
+        TaskStatus_t status;
+        vTaskGetInfo(xTaskGetIdleTaskHandleForCPU(core), &status, pdFALSE, eReady);
+        const uint32_t idle_us = status.ulRunTimeCounter - this->last_idle_runtime[core];
+        this->last_idle_runtime[core] = status.ulRunTimeCounter;
+
+        const uint8_t core_percent = elapsed_us > 0 ? (uint64_t) min(idle_us, elapsed_us) * 100 / elapsed_us : 0;
+        percent = min(percent, core_percent);
+    }
+    return percent;
+#else
+    return 0;
+#endif
+}
+
+void EFEnergyClass::setRadioActive(bool active) {
+    this->radio_active = active;
+}
+
+void EFEnergyClass::update(uint32_t led_ua) {
+    const unsigned long now = millis();
+    const uint32_t elapsed_ms = now - this->last_update_ms;
+    this->last_update_ms = now;
+
+#ifdef ESP_PLATFORM
+    uint32_t cpu_mhz = getCpuFrequencyMhz();
+#else
+    uint32_t cpu_mhz = 80;
+#endif
+    // Without power management, idle cores keep running at the same clock
+    uint32_t idle_cpu_ua = EFENERGY_CPU_BASE_UA + EFENERGY_CPU_UA_PER_MHZ * cpu_mhz;
+#if defined(ESP_PLATFORM) && defined(CONFIG_PM_ENABLE)
+    esp_pm_config_esp32s3_t pm_config;
+    if (esp_pm_get_configuration(&pm_config) == ESP_OK) {
+        // Tasks run at the maximum clock, idle cores drop to the minimum or sleep
+        cpu_mhz = pm_config.max_freq_mhz;
+        if (pm_config.light_sleep_enable && !this->radio_active) {
+            idle_cpu_ua = EFENERGY_LIGHT_SLEEP_UA;
+        } else {
+            idle_cpu_ua = EFENERGY_CPU_BASE_UA + EFENERGY_CPU_UA_PER_MHZ * pm_config.min_freq_mhz;
+        }
+    }
+#endif
+    this->idle_percent = this->measureIdlePercent();
+    const uint32_t busy_cpu_ua = EFENERGY_CPU_BASE_UA + EFENERGY_CPU_UA_PER_MHZ * cpu_mhz;
+    const uint32_t cpu_ua = (busy_cpu_ua * (100 - this->idle_percent) + idle_cpu_ua * this->idle_percent) / 100;
+    const uint32_t rail_ua = cpu_ua + (this->radio_active ? EFENERGY_RADIO_UA : 0);
+    this->current_ua = rail_ua * EFENERGY_3V3_FACTOR_PERCENT / 100 + led_ua * EFENERGY_LED_FACTOR_PERCENT / 100;
+
+    const uint64_t charge_uams = (uint64_t) this->current_ua * elapsed_ms;
+    this->boot_charge_uams += charge_uams;
+    if (this->num_accounts > 0) {
+        EFEnergyAccount& account = this->accounts[this->active_account];
+        account.charge_uams += charge_uams;
+        account.active_ms += elapsed_ms;
+    }
+
+    if (now - this->last_persist_ms >= EFENERGY_PERSIST_INTERVAL_MS) {
+        this->persist();
+    }
+}
+
+uint32_t EFEnergyClass::getCurrentUa() const {
+    return this->current_ua;
+}
+
+uint8_t EFEnergyClass::getIdlePercent() const {
+    return this->idle_percent;
+}
+
+float EFEnergyClass::getBootChargeMah() const {
+    return this->boot_charge_uams / EFENERGY_UAMS_PER_MAH;
+}
+
+float EFEnergyClass::getChargeMah(const char* name) const {
+    const int idx = this->findAccount(name);
+    if (idx < 0) {
+        return 0;
+    }
+    return this->accounts[idx].charge_uams / EFENERGY_UAMS_PER_MAH;
+}
+
+uint32_t EFEnergyClass::getAverageCurrentUa(const char* name) const {
+    const int idx = this->findAccount(name);
+    if (idx < 0 || this->accounts[idx].active_ms == 0) {
+        return 0;
+    }
+    return this->accounts[idx].charge_uams / this->accounts[idx].active_ms;
+}
+
+uint8_t EFEnergyClass::getAccountCount() const {
+    return this->num_accounts;
+}
+
+const EFEnergyAccount& EFEnergyClass::getAccount(uint8_t idx) const {
+    return this->accounts[idx];
+}
+
+void EFEnergyClass::logSummary() const {
+    LOGF_INFO(
+        "(EFEnergy) %.2f mAh since boot, currently %lu uA, CPU %d%% idle\r\n",
+        this->getBootChargeMah(),
+        (unsigned long) this->current_ua,
+        this->idle_percent
+    );
+    for (uint8_t i = 0; i < this->num_accounts; i++) {
+        const EFEnergyAccount& account = this->accounts[i];
+        LOGF_INFO(
+            "(EFEnergy)   %-20s %9.2f mAh %8lu s %7lu uA avg\r\n",
+            account.name,
+            account.charge_uams / EFENERGY_UAMS_PER_MAH,
+            (unsigned long) (account.active_ms / 1000),
+            (unsigned long) this->getAverageCurrentUa(account.name)
+        );
+    }
+}
+
+void EFEnergyClass::persist() {
+    this->last_persist_ms = millis();
+#ifdef ESP_PLATFORM
+    Preferences pref;
+    pref.begin(this->NVS_NAMESPACE, false);
+    pref.putUShort("layout", sizeof(EFEnergyAccount));
+    pref.putUChar("num", this->num_accounts);
+    pref.putBytes("accounts", this->accounts, this->num_accounts * sizeof(EFEnergyAccount));
+    pref.end();
+#endif
+    LOGF_DEBUG("(EFEnergy) Persisted %d accounts\r\n", this->num_accounts);
+}
+
+void EFEnergyClass::reset() {
+    for (uint8_t i = 0; i < this->num_accounts; i++) {
+        this->accounts[i].charge_uams = 0;
+        this->accounts[i].active_ms = 0;
+    }
+    this->boot_charge_uams = 0;
+    this->persist();
+}
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFENERGY)
+EFEnergyClass EFEnergy;
+#endif
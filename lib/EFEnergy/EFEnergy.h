@@ -0,0 +1,254 @@
+#ifndef EFENERGY_H_
+#define EFENERGY_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+/**
+ * @brief Maximum number of accounts (e.g. FSM states) energy is tracked for
+ */
+#define EFENERGY_MAX_ACCOUNTS 16
+
+/**
+ * @brief Maximum length of an account name, including the terminating zero
+ */
+#define EFENERGY_NAME_LEN 24
+
+/**
+ * @brief Name of the account charged once all other accounts are taken. Uses
+ * the last of the EFENERGY_MAX_ACCOUNTS slots.
+ */
+#define EFENERGY_OTHER_ACCOUNT "Other"
+
+/**
+ * @brief Maximum number of CPU cores idle time is measured for
+ */
+#define EFENERGY_MAX_CORES 2
+
+/**
+ * @brief Current of the ESP32-S3 without radio, independent of the clock, in uA
+ */
+#define EFENERGY_CPU_BASE_UA 11000
+
+/**
+ * @brief Additional current of the ESP32-S3 per MHz of CPU clock in uA
+ */
+#define EFENERGY_CPU_UA_PER_MHZ 140
+
+/**
+ * @brief Current of the ESP32-S3 in automatic light sleep, including the
+ * touch sensor used for wakeup, in uA
+ */
+#define EFENERGY_LIGHT_SLEEP_UA 1000
+
+/**
+ * @brief Average additional current while WiFi or the mesh is active in uA
+ */
+#define EFENERGY_RADIO_UA 95000
+
+/**
+ * @brief Battery current per LED current in percent. LEDs are powered from
+ * 5V via the boost converter (5V / 4V nominal V_BAT / 90% efficiency).
+ */
+#define EFENERGY_LED_FACTOR_PERCENT 139
+
+/**
+ * @brief Battery current per 3.3V rail current in percent (3.3V / 4V nominal
+ * V_BAT / 90% efficiency of the step-down converter)
+ */
+#define EFENERGY_3V3_FACTOR_PERCENT 92
+
+/**
+ * @brief Interval in milliseconds after which accounts are persisted to NVS
+ */
+#define EFENERGY_PERSIST_INTERVAL_MS (10 * 60 * 1000)
+
+/**
+ * @brief Energy used by a single account
+ */
+struct EFEnergyAccount {
+    char name[EFENERGY_NAME_LEN];  //!< Name of the account
+    uint64_t charge_uams;          //!< Charge drawn from the batteries in uA*ms
+    uint32_t active_ms;            //!< Time the account was active in ms
+};
+
+/**
+ * @brief Estimates the charge drawn from the batteries and attributes it to
+ * the currently active account, usually the current FSM state.
+ *
+ * The estimate combines the LED current of the last pushed frame, the CPU
+ * clock and the radio state. The time both CPU cores spent idle is charged at
+ * the minimum clock of frequency scaling or at the light sleep current, if
+ * power management enables them. Idle time is taken from the FreeRTOS run
+ * time statistics, which requires CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS.
+ * Without it, the CPU is assumed to be busy all the time.
+ *
+ * Accounts accumulate across boots: they are restored from NVS by begin() and
+ * persisted periodically by update().
+ */
+class EFEnergyClass {
+
+    protected:
+
+        EFEnergyAccount accounts[EFENERGY_MAX_ACCOUNTS];  //!< All known accounts
+        uint8_t num_accounts;                             //!< Number of used accounts
+        uint8_t active_account;                           //!< Index of the account charged by update()
+        bool radio_active;                                //!< True, while WiFi or the mesh is active
+        uint32_t current_ua;                              //!< Battery current estimated by the last update()
+        uint8_t idle_percent;                             //!< Share of time all CPU cores were idle during the last update() interval
+        uint32_t last_idle_runtime[EFENERGY_MAX_CORES];   //!< Run time counter of the idle task of each core at the last update()
+        unsigned long last_update_us;                     //!< Timestamp of the last update() in us
+        uint64_t boot_charge_uams;                        //!< Charge drawn since boot in uA*ms
+        unsigned long last_update_ms;                     //!< Timestamp of the last update()
+        unsigned long last_persist_ms;                    //!< Timestamp of the last persist()
+
+        const char* NVS_NAMESPACE = "efenergy";  //!< Namespace accounts are persisted under in NVS
+
+        /**
+         * @brief Finds the account with the given name
+         *
+         * @return Index of the account or -1, if no such account exists
+         */
+        int findAccount(const char* name) const;
+
+        /**
+         * @brief Selects the EFENERGY_OTHER_ACCOUNT account. Creates it in the
+         * last slot, if it does not exist yet.
+         */
+        void setOtherAccount();
+
+        /**
+         * @brief Measures the share of time all CPU cores were idle since the
+         * last call
+         *
+         * @return Idle time in percent, 0 if unknown
+         */
+        uint8_t measureIdlePercent();
+
+    public:
+
+        /**
+         * @brief Constructs a new EFEnergyClass instance
+         */
+        EFEnergyClass();
+
+        /**
+         * @brief Restores all accounts from NVS
+         */
+        void begin();
+
+        /**
+         * @brief Selects the account future charge is attributed to. Creates
+         * it, if it does not exist yet. If all accounts are taken, charge is
+         * attributed to the EFENERGY_OTHER_ACCOUNT account.
+         *
+         * @param name Name of the account, e.g. FSMState::getName()
+         */
+        void setAccount(const char* name);
+
+        /**
+         * @brief Tells the model whether WiFi or the mesh is currently active
+         */
+        void setRadioActive(bool active);
+
+        /**
+         * @brief Attributes the charge drawn since the last call to the active
+         * account. Should be called regularly, e.g. every FSM tick.
+         *
+         * @param led_ua Current the LEDs currently draw from the 5V rail in uA
+         */
+        void update(uint32_t led_ua);
+
+        /**
+         * @brief Retrieves the battery current estimated by the last update()
+         *
+         * @return Estimated battery current in uA
+         */
+        uint32_t getCurrentUa() const;
+
+        /**
+         * @brief Retrieves the share of time all CPU cores were idle during
+         * the interval before the last update()
+         *
+         * @return Idle time in percent, 0 if unknown
+         */
+        uint8_t getIdlePercent() const;
+
+        /**
+         * @brief Retrieves the charge drawn since boot
+         *
+         * @return Charge in mAh
+         */
+        float getBootChargeMah() const;
+
+        /**
+         * @brief Retrieves the charge attributed to the given account across all boots
+         *
+         * @return Charge in mAh or 0, if the account does not exist
+         */
+        float getChargeMah(const char* name) const;
+
+        /**
+         * @brief Retrieves the average battery current of the given account
+         * across all boots
+         *
+         * @return Average current in uA or 0, if the account does not exist
+         * or was never active
+         */
+        uint32_t getAverageCurrentUa(const char* name) const;
+
+        /**
+         * @brief Retrieves the number of accounts
+         */
+        uint8_t getAccountCount() const;
+
+        /**
+         * @brief Provides access to the account with the given index
+         *
+         * @param idx Index of the account, must be less than getAccountCount()
+         */
+        const EFEnergyAccount& getAccount(uint8_t idx) const;
+
+        /**
+         * @brief Writes a summary of all accounts to the serial log
+         */
+        void logSummary() const;
+
+        /**
+         * @brief Persists all accounts to NVS
+         */
+        void persist();
+
+        /**
+         * @brief Zeroes the charge and time of all accounts, including the
+         * ones persisted to NVS
+         */
+        void reset();
+};
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFENERGY)
+extern EFEnergyClass EFEnergy;
+#endif
+
+#endif /* EFENERGY_H_ */
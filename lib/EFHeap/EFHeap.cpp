@@ -0,0 +1,195 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdlib.h>
+
+#ifdef ESP_PLATFORM
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+#ifdef EFHEAP_TRACE
+#include <new>
+#endif
+
+#include "EFHeap.h"
+
+/**
+ * @brief Identifies the calling task. Always nullptr on the host, which only
+ * runs a single thread.
+ */
+static inline void* currentTask() {
+#ifdef ESP_PLATFORM
+    return (void*) xTaskGetCurrentTaskHandle();
+#else
+    return nullptr;
+#endif
+}
+
+EFHeapClass::EFHeapClass()
+: tick_task(nullptr)
+, tick_active(false)
+, untracked(0)
+, tick_ops(0)
+, tick_ops_max(0)
+, alloc_count(0)
+, free_count(0)
+{
+}
+
+bool EFHeapClass::isTracking() {
+    return this->tick_active && this->untracked == 0 && currentTask() == this->tick_task;
+}
+
+void EFHeapClass::beginTick() {
+    this->tick_ops = 0;
+    this->tick_task = currentTask();
+    this->tick_active = true;
+}
+
+uint32_t EFHeapClass::endTick() {
+    this->tick_active = false;
+    if (this->tick_ops > this->tick_ops_max) {
+        this->tick_ops_max = this->tick_ops;
+    }
+    return this->tick_ops;
+}
+
+uint32_t EFHeapClass::getTickOpsMax() {
+    return this->tick_ops_max;
+}
+
+uint32_t EFHeapClass::getAllocCount() {
+    return this->alloc_count;
+}
+
+uint32_t EFHeapClass::getFreeCount() {
+    return this->free_count;
+}
+
+void EFHeapClass::recordAlloc() {
+    if (this->isTracking()) {
+        this->tick_ops++;
+        this->alloc_count++;
+    }
+}
+
+void EFHeapClass::recordFree() {
+    if (this->isTracking()) {
+        this->tick_ops++;
+        this->free_count++;
+    }
+}
+
+void EFHeapClass::suspendTracking() {
+    this->untracked++;
+}
+
+void EFHeapClass::resumeTracking() {
+    if (this->untracked > 0) {
+        this->untracked--;
+    }
+}
+
+EFHeapUntrackedScope::EFHeapUntrackedScope() {
+    EFHeap.suspendTracking();
+}
+
+EFHeapUntrackedScope::~EFHeapUntrackedScope() {
+    EFHeap.resumeTracking();
+}
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFHEAP)
+EFHeapClass EFHeap;
+#endif
+
+#ifdef EFHEAP_TRACE
+#ifdef ESP_PLATFORM
+
+// Heap hooks, see EFHeapClass. The linker redirects all calls to malloc() and
+// friends to the __wrap_ variants and __real_ to the original implementation.
+extern "C" {
+    void* __real_malloc(size_t size);
+    void* __real_calloc(size_t num, size_t size);
+    void* __real_realloc(void* ptr, size_t size);
+    void __real_free(void* ptr);
+
+    void* __wrap_malloc(size_t size) {
+        EFHeap.recordAlloc();
+        return __real_malloc(size);
+    }
+
+    void* __wrap_calloc(size_t num, size_t size) {
+        EFHeap.recordAlloc();
+        return __real_calloc(num, size);
+    }
+
+    void* __wrap_realloc(void* ptr, size_t size) {
+        EFHeap.recordAlloc();
+        return __real_realloc(ptr, size);
+    }
+
+    void __wrap_free(void* ptr) {
+        if (ptr) {
+            EFHeap.recordFree();
+        }
+        __real_free(ptr);
+    }
+}
+
+#else
+
+// Heap hooks, see EFHeapClass. On the host, only C++ allocations are counted.
+void* operator new(size_t size) {
+    EFHeap.recordAlloc();
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr) {
+        EFHeap.recordFree();
+    }
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+#endif /* ESP_PLATFORM */
+#endif /* EFHEAP_TRACE */
@@ -0,0 +1,148 @@
+#ifndef EFHEAP_H_
+#define EFHEAP_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Counts heap operations (allocations and frees) made by a single task
+ * during a tick, e.g. while the FSM renders a frame.
+ *
+ * Counting requires the build flag EFHEAP_TRACE. On the ESP32, malloc(),
+ * calloc(), realloc() and free() are hooked via the linker and additionally
+ * require:
+ *
+ *     -Wl,--wrap=malloc -Wl,--wrap=calloc -Wl,--wrap=realloc -Wl,--wrap=free
+ *
+ * On the host, the global operator new / delete are replaced instead. Without
+ * EFHEAP_TRACE, all counters stay at 0 and the class has no overhead besides
+ * the calls themselves.
+ *
+ * Only the task that called beginTick() modifies the counters, so they need
+ * no locking even though all tasks pass through the hooks.
+ */
+class EFHeapClass {
+
+    protected:
+
+        void* volatile tick_task;   //!< Task whose heap operations are counted
+        volatile bool tick_active;  //!< True between beginTick() and endTick()
+        uint8_t untracked;          //!< Nesting depth of suspendTracking() calls
+        uint32_t tick_ops;          //!< Heap operations during the current / last tick
+        uint32_t tick_ops_max;      //!< Maximum of heap operations seen in a single tick
+        uint32_t alloc_count;       //!< Allocations made by tracked ticks since boot
+        uint32_t free_count;        //!< Frees made by tracked ticks since boot
+
+        /**
+         * @brief Determines if an operation of the calling task belongs to the
+         * current tick
+         */
+        bool isTracking();
+
+    public:
+
+        /**
+         * @brief Constructs a new EFHeapClass instance
+         */
+        EFHeapClass();
+
+        /**
+         * @brief Starts counting the heap operations of the calling task
+         */
+        void beginTick();
+
+        /**
+         * @brief Stops counting heap operations
+         *
+         * @return Number of heap operations since the last call to beginTick()
+         */
+        uint32_t endTick();
+
+        /**
+         * @brief Maximum number of heap operations seen in a single tick
+         */
+        uint32_t getTickOpsMax();
+
+        /**
+         * @brief Number of allocations counted since boot
+         */
+        uint32_t getAllocCount();
+
+        /**
+         * @brief Number of frees counted since boot
+         */
+        uint32_t getFreeCount();
+
+        /**
+         * @brief Records an allocation. Called by the heap hooks.
+         */
+        void recordAlloc();
+
+        /**
+         * @brief Records a free. Called by the heap hooks.
+         */
+        void recordFree();
+
+        /**
+         * @brief Excludes heap operations from counting until a matching
+         * call to resumeTracking(). Calls may be nested. Must be called from
+         * the task that ticks.
+         */
+        void suspendTracking();
+
+        /**
+         * @brief Reverts a previous call to suspendTracking()
+         */
+        void resumeTracking();
+};
+
+/**
+ * @brief Excludes the heap operations made within a scope from the per tick
+ * counters. Used for deliberate, amortized allocations such as filling a
+ * cache or for third party code that allocates by design.
+ */
+class EFHeapUntrackedScope {
+
+    public:
+
+        /**
+         * @brief Suspends tracking on the global EFHeap instance
+         */
+        EFHeapUntrackedScope();
+
+        /**
+         * @brief Resumes tracking on the global EFHeap instance
+         */
+        ~EFHeapUntrackedScope();
+
+        EFHeapUntrackedScope(const EFHeapUntrackedScope&) = delete;
+        EFHeapUntrackedScope& operator=(const EFHeapUntrackedScope&) = delete;
+};
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFHEAP)
+extern EFHeapClass EFHeap;
+#endif
+
+#endif /* EFHEAP_H_ */
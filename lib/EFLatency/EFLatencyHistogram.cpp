@@ -0,0 +1,106 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "EFLatencyHistogram.h"
+
+EFLatencyHistogram::EFLatencyHistogram()
+: buckets()
+, count(0)
+, max_us(0)
+{
+}
+
+uint8_t EFLatencyHistogram::bucketOf(uint32_t us) {
+    if (us < EFLATENCY_SUB_BUCKETS) {
+        return us;
+    }
+
+    // Exponent e of the highest set bit. The next two bits select the sub bucket.
+    const uint8_t e = 31 - __builtin_clz(us);
+    if (e > EFLATENCY_MAX_EXPONENT) {
+        return EFLATENCY_NUM_BUCKETS - 1;
+    }
+    const uint8_t sub = (us >> (e - 2)) & (EFLATENCY_SUB_BUCKETS - 1);
+    return EFLATENCY_SUB_BUCKETS + (e - 2) * EFLATENCY_SUB_BUCKETS + sub;
+}
+
+uint32_t EFLatencyHistogram::upperBoundOf(uint8_t bucket) {
+    if (bucket < EFLATENCY_SUB_BUCKETS) {
+        return bucket;
+    }
+
+    const uint8_t e = (bucket - EFLATENCY_SUB_BUCKETS) / EFLATENCY_SUB_BUCKETS + 2;
+    const uint8_t sub = bucket % EFLATENCY_SUB_BUCKETS;
+    return (((uint32_t) (EFLATENCY_SUB_BUCKETS + sub + 1)) << (e - 2)) - 1;
+}
+
+void EFLatencyHistogram::record(uint32_t us) {
+    const uint8_t bucket = bucketOf(us);
+    if (this->buckets[bucket] < UINT16_MAX) {
+        this->buckets[bucket]++;
+    }
+    this->count++;
+    if (us > this->max_us) {
+        this->max_us = us;
+    }
+}
+
+void EFLatencyHistogram::reset() {
+    for (uint8_t i = 0; i < EFLATENCY_NUM_BUCKETS; i++) {
+        this->buckets[i] = 0;
+    }
+    this->count = 0;
+    this->max_us = 0;
+}
+
+uint32_t EFLatencyHistogram::getCount() const {
+    return this->count;
+}
+
+uint32_t EFLatencyHistogram::getMax() const {
+    return this->max_us;
+}
+
+uint32_t EFLatencyHistogram::getPercentile(uint8_t percent) const {
+    // Bucket counts saturate, so sum them up instead of relying on count
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < EFLATENCY_NUM_BUCKETS; i++) {
+        total += this->buckets[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    const uint32_t rank = (total * percent + 99) / 100;
+    uint32_t seen = 0;
+    for (uint8_t i = 0; i < EFLATENCY_NUM_BUCKETS; i++) {
+        seen += this->buckets[i];
+        if (seen >= rank) {
+            if (i == EFLATENCY_NUM_BUCKETS - 1) {
+                return this->max_us;
+            }
+            const uint32_t bound = upperBoundOf(i);
+            return bound < this->max_us ? bound : this->max_us;
+        }
+    }
+    return this->max_us;
+}
@@ -0,0 +1,111 @@
+#ifndef EFLATENCY_HISTOGRAM_H_
+#define EFLATENCY_HISTOGRAM_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+/**
+ * @brief Number of buckets per power of two. Bounds the relative error of
+ * reported percentiles to 1 / EFLATENCY_SUB_BUCKETS.
+ */
+#define EFLATENCY_SUB_BUCKETS 4
+
+/**
+ * @brief Largest power of two (in us) the histogram resolves. Larger samples
+ * are counted in the last bucket. 2^22 us are about 4 s.
+ */
+#define EFLATENCY_MAX_EXPONENT 22
+
+/**
+ * @brief Total number of buckets of an EFLatencyHistogram
+ */
+#define EFLATENCY_NUM_BUCKETS (EFLATENCY_SUB_BUCKETS + (EFLATENCY_MAX_EXPONENT - 1) * EFLATENCY_SUB_BUCKETS)
+
+/**
+ * @brief Fixed-size, log-linear histogram of latencies in microseconds
+ *
+ * Each power of two is split into EFLATENCY_SUB_BUCKETS linear buckets, so
+ * small and large latencies are resolved with the same relative precision.
+ * Recording is O(1) and never allocates. Percentiles are reported as the
+ * upper bound of the bucket they fall into.
+ */
+class EFLatencyHistogram {
+
+    protected:
+
+        uint16_t buckets[EFLATENCY_NUM_BUCKETS];  //!< Number of samples per bucket. Saturates at 65535.
+        uint32_t count;                           //!< Total number of recorded samples
+        uint32_t max_us;                          //!< Largest recorded sample
+
+        /**
+         * @brief Maps a latency to its bucket
+         */
+        static uint8_t bucketOf(uint32_t us);
+
+        /**
+         * @brief Retrieves the largest latency that falls into the given bucket
+         */
+        static uint32_t upperBoundOf(uint8_t bucket);
+
+    public:
+
+        /**
+         * @brief Constructs a new, empty histogram
+         */
+        EFLatencyHistogram();
+
+        /**
+         * @brief Records a single sample
+         *
+         * @param us Latency in microseconds
+         */
+        void record(uint32_t us);
+
+        /**
+         * @brief Removes all samples
+         */
+        void reset();
+
+        /**
+         * @brief Retrieves the number of recorded samples
+         */
+        uint32_t getCount() const;
+
+        /**
+         * @brief Retrieves the largest recorded sample
+         *
+         * @return Latency in microseconds
+         */
+        uint32_t getMax() const;
+
+        /**
+         * @brief Retrieves the latency below which the given share of samples lies
+         *
+         * @param percent Percentile to retrieve, e.g. 50 or 99
+         * @return Latency in microseconds or 0, if no samples were recorded
+         */
+        uint32_t getPercentile(uint8_t percent) const;
+};
+
+#endif /* EFLATENCY_HISTOGRAM_H_ */
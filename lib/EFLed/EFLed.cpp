@@ -30,30 +30,55 @@
 #include <EFLogging.h>
 
 #include "EFLed.h"
+#include "EFLedGeometry.h"
+#include "EFLedOutputFastLED.h"
+#include "EFLedOutputMock.h"
+#include "EFLedOutputRMT.h"
+
+static_assert(EFLED_TOTAL_NUM * 3 <= EFLED_OUTPUT_MAX_BYTES, "EFLED_OUTPUT_MAX_BYTES too small");
+static_assert(EFLED_TOTAL_NUM <= EFLED_OUTPUT_STAGE_MAX_LEDS, "EFLED_OUTPUT_STAGE_MAX_LEDS too small");
+static_assert(EFLED_TOTAL_NUM <= EFLED_COMPOSITOR_MAX_LEDS, "EFLED_COMPOSITOR_MAX_LEDS too small");
+
+#if defined(EFLED_OUTPUT_FASTLED)
+static EFLedOutputFastLED<EFLED_PIN_LED_DATA> default_output;
+#elif defined(ESP_PLATFORM)
+static EFLedOutputRMT default_output(RMT_CHANNEL_0);
+#else
+static EFLedOutputMock default_output;
+#endif
 
-static const EFLedClass::LEDPosition led_positions[] = {
-    {17, 126},  // 0
-    {21, 106},
-    {23, 91},
-    {41, 86},
-    {35, 48},
-    {37, 43},  // 5
-    {61, 15},
-    {61, 27},
-    {61, 41},
-    {61, 54},
-    {61, 67},  // 10
-    {61, 79},
-    {61, 93},
-    {61, 105},
-    {61, 118},
-    {61, 131},  // 15
-    {61, 144}
-};
+bool EFLedClass::output_invalidated = true;
 
 EFLedClass::EFLedClass()
-: max_brightness(0)
-, led_data({0})
+: led_data({0})
+, max_brightness(0)
+, brightness(0)
+, output(&default_output)
+, output_stage()
+, compositor()
+, power_model()
+, frame_current_ua(0)
+, frames_limited(0)
+, frame_depth(0)
+, frame_pending(false)
+, last_fingerprint(0)
+, last_push_ms(0)
+, forced_refresh_ms(EFLED_FORCED_REFRESH_MS_DEFAULT)
+, frames_pushed(0)
+, frames_skipped(0)
+, last_wire()
+, frame_delta(0)
+, power_gating_ms(EFLED_POWER_GATING_MS_DEFAULT)
+, power_gated(false)
+, dark_since_ms(0)
+, gated_since_ms(0)
+, gated_total_ms(0)
+, gated_count(0)
+, led_indices()
+, palette(nullptr)
+, palette_len(0)
+, palette_offset(0)
+, indexed_region(EFLED_REGION_ALL)
 {
 }
 
@@ -67,12 +92,23 @@ void EFLedClass::init(const uint8_t absolute_max_brightness) {
     }
     LOG_INFO("(EFLed) Initialized internal LED data struct");
 
-    FastLED.clearData();
-    FastLED.addLeds<WS2812B, EFLED_PIN_LED_DATA, GRB>(this->led_data, EFLED_TOTAL_NUM);
-    LOGF_DEBUG("(EFLed) Added new WS2812B: %d LEDs @ PIN %d\r\n", EFLED_TOTAL_NUM, EFLED_PIN_LED_DATA);
+    if (this->output->begin(EFLED_PIN_LED_DATA, EFLED_TOTAL_NUM * 3)) {
+        LOGF_DEBUG("(EFLed) Added new WS2812B: %d LEDs @ PIN %d\r\n", EFLED_TOTAL_NUM, EFLED_PIN_LED_DATA);
+    } else {
+        LOG_ERROR("(EFLed) Failed to initialize LED output");
+    }
+
+    this->frame_depth = 0;
+    this->frame_pending = false;
+    this->frames_pushed = 0;
+    this->frames_skipped = 0;
+    this->frames_limited = 0;
+    this->output_stage.reset();
+    this->compositor.init(EFLED_TOTAL_NUM);
+    this->invalidate();
 
     this->max_brightness = absolute_max_brightness;
-    FastLED.setBrightness(this->max_brightness);
+    this->brightness = this->max_brightness;
     LOGF_DEBUG("(EFLed) Set max_brightness=%d\r\n", this->max_brightness)
 
     enablePower();
@@ -81,88 +117,434 @@ void EFLedClass::init(const uint8_t absolute_max_brightness) {
 void EFLedClass::enablePower() {
     pinMode(EFLED_PIN_5VBOOST_ENABLE, OUTPUT);
     digitalWrite(EFLED_PIN_5VBOOST_ENABLE, HIGH);
+    output_invalidated = true;
     LOG_INFO("(EFLed) Enabled +5V boost converter");
     delay(1);
 }
 
 void EFLedClass::disablePower() {
     digitalWrite(EFLED_PIN_5VBOOST_ENABLE, LOW);
+    output_invalidated = true;
     LOG_INFO("(EFLed) Disabled +5V boost converter");
     delay(10);
 }
 
+void EFLedClass::show() {
+    if (this->frame_depth > 0) {
+        this->frame_pending = true;
+        return;
+    }
+
+    if (this->palette) {
+        this->expandIndexed();
+    }
+    const CRGB* frame = this->compositor.compose(this->led_data);
+
+    // Skip frames that would not change what is visible
+    const uint32_t fingerprint = this->fingerprint(frame);
+    bool dark = true;
+    for (uint8_t i = 0; i < EFLED_TOTAL_NUM && this->brightness > 0; i++) {
+        if (frame[i]) {
+            dark = false;
+            break;
+        }
+    }
+    this->updatePowerGating(dark, fingerprint == this->last_fingerprint);
+
+    // Unpowered LEDs need no refresh
+    const bool refresh_due = !this->power_gated && this->forced_refresh_ms > 0 && millis() - this->last_push_ms >= this->forced_refresh_ms;
+    if (!output_invalidated && !refresh_due && fingerprint == this->last_fingerprint) {
+        this->frames_skipped++;
+        this->frame_delta = 0;
+        return;
+    }
+
+    // Re-send a forced refresh of an unchanged frame as is. Rendering it again
+    // would advance the dithering and make static content flicker.
+    if (!output_invalidated && fingerprint == this->last_fingerprint) {
+        memcpy(this->output->backBuffer(), this->last_wire, sizeof(this->last_wire));
+        if (!this->output->submit()) {
+            LOG_WARNING("(EFLed) Dropped refresh: LED output busy");
+            return;
+        }
+        this->frames_pushed++;
+        this->frame_delta = 0;
+        this->last_push_ms = millis();
+        return;
+    }
+
+    // Dim frames that would overload the 5V boost converter
+    const uint8_t frame_brightness = this->power_model.limitBrightness(frame, EFLED_TOTAL_NUM, this->brightness);
+    if (frame_brightness < this->brightness) {
+        this->frames_limited++;
+    }
+
+    uint8_t* wire = this->output->backBuffer();
+    this->render(frame, wire, frame_brightness);
+    const uint8_t delta = this->perceptualDelta(wire);
+    if (!this->output->submit()) {
+        LOG_WARNING("(EFLed) Dropped frame: LED output busy");
+        return;
+    }
+    this->frames_pushed++;
+    this->frame_delta = delta;
+    memcpy(this->last_wire, wire, sizeof(this->last_wire));
+    this->last_fingerprint = fingerprint;
+    this->last_push_ms = millis();
+    this->frame_current_ua = this->power_model.estimateCurrent(frame, EFLED_TOTAL_NUM, frame_brightness);
+    output_invalidated = false;
+}
+
+void EFLedClass::update() {
+    this->compositor.markBaseDirty();
+    this->show();
+}
+
+void EFLedClass::expandIndexed() {
+    for (uint8_t i = this->indexed_region.offset; i < this->indexed_region.offset + this->indexed_region.num; i++) {
+        this->led_data[i] = this->palette[(this->led_indices[i] + this->palette_offset) % this->palette_len];
+    }
+}
+
+uint32_t EFLedClass::fingerprint(const CRGB* frame) const {
+    uint32_t hash = 2166136261UL;
+    for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+        for (uint8_t c = 0; c < 3; c++) {
+            hash = (hash ^ frame[i].raw[c]) * 16777619UL;
+        }
+    }
+    return (hash ^ this->brightness) * 16777619UL;
+}
+
+void EFLedClass::updatePowerGating(bool dark, bool shown) {
+    if (!dark) {
+        this->dark_since_ms = 0;
+        if (this->power_gated) {
+            // Bring the rail back up before the frame is sent
+            digitalWrite(EFLED_PIN_5VBOOST_ENABLE, HIGH);
+            delay(EFLED_POWER_SETTLE_MS);
+            output_invalidated = true;
+            this->power_gated = false;
+            this->gated_total_ms += millis() - this->gated_since_ms;
+        }
+        return;
+    }
+
+    if (this->dark_since_ms == 0) {
+        this->dark_since_ms = max(millis(), 1UL);
+    }
+
+    // Only gate once the black frame reached the LEDs, so they do not hold stale colors
+    if (
+        !this->power_gated &&
+        this->power_gating_ms > 0 &&
+        millis() - this->dark_since_ms >= this->power_gating_ms &&
+        shown &&
+        !output_invalidated &&
+        !this->output->isBusy()
+    ) {
+        digitalWrite(EFLED_PIN_5VBOOST_ENABLE, LOW);
+        this->power_gated = true;
+        this->gated_since_ms = millis();
+        this->gated_count++;
+    }
+}
+
+uint8_t EFLedClass::perceptualDelta(const uint8_t* wire) const {
+    uint8_t delta = 0;
+    for (uint8_t i = 0; i < EFLED_TOTAL_NUM * 3; i++) {
+        const uint8_t a = wire[i];
+        const uint8_t b = this->last_wire[i];
+        if (a == b) {
+            continue;
+        }
+
+        // Weber contrast: difference relative to the brighter of both levels
+        const uint16_t diff = a > b ? a - b : b - a;
+        const uint16_t level = (a > b ? a : b) + EFLED_PERCEPTUAL_DELTA_FLOOR;
+        const uint16_t contrast = (diff << 8) / level;
+        if (contrast > delta) {
+            delta = contrast > 255 ? 255 : contrast;
+        }
+    }
+    return delta;
+}
+
+void EFLedClass::render(const CRGB* frame, uint8_t* wire, uint8_t brightness) {
+    this->output_stage.render(frame, EFLED_TOTAL_NUM, brightness, wire);
+}
+
+void EFLedClass::setOutput(EFLedOutput* output) {
+    if (output) {
+        this->output = output;
+    }
+}
+
+EFLedOutput* EFLedClass::getOutput() const {
+    return this->output;
+}
+
+bool EFLedClass::flush() {
+    return this->output->flush();
+}
+
+void EFLedClass::beginFrame() {
+    this->frame_depth++;
+}
+
+void EFLedClass::commitFrame() {
+    if (this->frame_depth == 0) {
+        LOG_WARNING("(EFLed) commitFrame() called without open frame");
+        return;
+    }
+
+    this->frame_depth--;
+    if (this->frame_depth == 0 && this->frame_pending) {
+        this->frame_pending = false;
+        this->show();
+    }
+}
+
+bool EFLedClass::isFrameOpen() const {
+    return this->frame_depth > 0;
+}
+
+uint32_t EFLedClass::getPushedFrameCount() const {
+    return this->frames_pushed;
+}
+
+uint32_t EFLedClass::getSkippedFrameCount() const {
+    return this->frames_skipped;
+}
+
+uint8_t EFLedClass::getFrameDelta() const {
+    return this->frame_delta;
+}
+
+void EFLedClass::setPowerGating(uint16_t gating_ms) {
+    this->power_gating_ms = gating_ms;
+}
+
+bool EFLedClass::isPowerGated() const {
+    return this->power_gated;
+}
+
+uint32_t EFLedClass::getPowerGatedMs() const {
+    if (this->power_gated) {
+        return this->gated_total_ms + (millis() - this->gated_since_ms);
+    }
+    return this->gated_total_ms;
+}
+
+uint32_t EFLedClass::getPowerGatedCount() const {
+    return this->gated_count;
+}
+
+void EFLedClass::setForcedRefreshInterval(uint16_t interval_ms) {
+    this->forced_refresh_ms = interval_ms;
+}
+
+void EFLedClass::invalidate() {
+    output_invalidated = true;
+}
+
+void EFLedClass::setGammaCorrection(bool enabled) {
+    this->output_stage.setGammaCorrection(enabled);
+    this->power_model.setGammaCorrection(enabled);
+    this->invalidate();
+    this->show();
+}
+
+void EFLedClass::setDithering(bool enabled) {
+    this->output_stage.setDithering(enabled);
+    this->invalidate();
+    this->show();
+}
+
+void EFLedClass::setWhiteBalance(const CRGB correction) {
+    this->output_stage.setWhiteBalance(correction);
+    this->power_model.setWhiteBalance(correction);
+    this->invalidate();
+    this->show();
+}
+
+void EFLedClass::setLayerPixel(EFLedLayer layer, uint8_t idx, const CRGB color) {
+    this->compositor.setPixel(layer, idx, color);
+    this->show();
+}
+
+void EFLedClass::setLayerPixels(EFLedLayer layer, const CRGB* colors) {
+    this->compositor.setPixels(layer, colors);
+    this->show();
+}
+
+void EFLedClass::clearLayer(EFLedLayer layer) {
+    this->compositor.clear(layer);
+    this->show();
+}
+
+void EFLedClass::setLayerRegion(EFLedLayer layer, const EFLedRegion region) {
+    this->compositor.setRegion(layer, region);
+    this->show();
+}
+
+void EFLedClass::setLayerBlendMode(EFLedLayer layer, EFLedBlendMode mode) {
+    this->compositor.setBlendMode(layer, mode);
+    this->show();
+}
+
+void EFLedClass::setLayerOpacity(EFLedLayer layer, uint8_t opacity) {
+    this->compositor.setOpacity(layer, opacity);
+    this->show();
+}
+
+void EFLedClass::setCurrentBudget(uint16_t budget_ma) {
+    if (budget_ma == this->power_model.getBudget()) {
+        return;
+    }
+
+    this->power_model.setBudget(budget_ma);
+    LOGF_DEBUG("(EFLed) Set current budget=%d mA\r\n", budget_ma);
+    this->invalidate();
+    this->show();
+}
+
+uint16_t EFLedClass::getCurrentBudget() const {
+    return this->power_model.getBudget();
+}
+
+uint16_t EFLedClass::getEstimatedCurrent() const {
+    if (this->power_gated) {
+        return 0;
+    }
+    return this->frame_current_ua / 1000;
+}
+
+uint32_t EFLedClass::getLimitedFrameCount() const {
+    return this->frames_limited;
+}
+
 void EFLedClass::clear() {
+    this->palette = nullptr;
     for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
         this->led_data[i] = CRGB::Black;
     }
-    FastLED.show();
+    this->update();
+}
+
+void EFLedClass::setIndexed(const EFLedRegion region, const uint8_t* indices, const CRGB* palette, uint16_t palette_len) {
+    if (!palette || palette_len == 0 || palette_len > 256 || region.offset + region.num > EFLED_TOTAL_NUM) {
+        LOG_WARNING("(EFLed) Ignored invalid indexed mode");
+        return;
+    }
+
+    this->indexed_region = region;
+    for (uint8_t i = 0; i < region.num; i++) {
+        this->led_indices[region.offset + i] = indices[i];
+    }
+    this->palette = palette;
+    this->palette_len = palette_len;
+    this->palette_offset = 0;
+    this->update();
+}
+
+void EFLedClass::setPalette(const CRGB* palette, uint16_t palette_len) {
+    if (!this->palette || !palette || palette_len == 0 || palette_len > 256) {
+        return;
+    }
+
+    this->palette = palette;
+    this->palette_len = palette_len;
+    this->update();
+}
+
+void EFLedClass::setPaletteOffset(uint16_t offset) {
+    if (!this->palette) {
+        return;
+    }
+
+    this->palette_offset = offset % this->palette_len;
+    this->update();
+}
+
+void EFLedClass::clearIndexed() {
+    if (!this->palette) {
+        return;
+    }
+
+    this->expandIndexed();
+    this->palette = nullptr;
+}
+
+bool EFLedClass::isIndexed() const {
+    return this->palette != nullptr;
 }
 
 void EFLedClass::setBrightnessPercent(uint8_t brightness) {
-    FastLED.setBrightness(round((min(brightness, (uint8_t) 100) / (float) 100) * this->max_brightness));
-    FastLED.show();
+    this->brightness = round((min(brightness, (uint8_t) 100) / (float) 100) * this->max_brightness);
+    this->show();
 }
 
 uint8_t EFLedClass::getBrightnessPercent() const {
-    return (uint8_t) round(FastLED.getBrightness() / (float) this->max_brightness * 100);
+    return (uint8_t) round(this->brightness / (float) this->max_brightness * 100);
 }
 
 void EFLedClass::setAll(const CRGB color[EFLED_TOTAL_NUM]) {
     for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
         this->led_data[i] = color[i];
     }
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setAllSolid(const CRGB color) {
     for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
         this->led_data[i] = color;
     }
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setDragonNose(const CRGB color) {
     this->led_data[EFLED_DRAGON_NOSE_IDX] = color;
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setDragonMuzzle(const CRGB color) {
     this->led_data[EFLED_DRAGON_MUZZLE_IDX] = color;
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setDragonEye(const CRGB color) {
     this->led_data[EFLED_DRAGON_EYE_IDX] = color;
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setDragonCheek(const CRGB color) {
     this->led_data[EFLED_DRAGON_CHEEK_IDX] = color;
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setDragonEarBottom(const CRGB color) {
     this->led_data[EFLED_DRAGON_EAR_BOTTOM_IDX] = color;
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setDragonEarTop(const CRGB color) {
     this->led_data[EFLED_DRAGON_EAR_TOP_IDX] = color;
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setDragon(const CRGB color[EFLED_DRAGON_NUM]) {
     for (uint8_t i = 0; i < EFLED_DRAGON_NUM; i++) {
         this->led_data[EFLED_DARGON_OFFSET + i] = color[i];
     }
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setEFBar(const CRGB color[EFLED_EFBAR_NUM]) {
     for (uint8_t i = 0; i < EFLED_EFBAR_NUM; i++) {
         this->led_data[EFLED_EFBAR_OFFSET + i] = color[i];
     }
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setEFBar(uint8_t idx, const CRGB color) {
@@ -171,7 +553,7 @@ void EFLedClass::setEFBar(uint8_t idx, const CRGB color) {
     }
 
     this->led_data[EFLED_EFBAR_OFFSET + idx] = color;
-    FastLED.show();
+    this->update();
 }
 
 void EFLedClass::setEFBarCursor(
@@ -181,15 +563,15 @@ void EFLedClass::setEFBarCursor(
 ) {
     for (int8_t i = 0; i < EFLED_EFBAR_NUM; i++) {
         int8_t distance = abs((int16_t)idx - i);
-        uint8_t fade = static_cast<uint8_t>(std::clamp(distance * 64.0f, 0.0f, 255.0f));
+        uint8_t fade = min(distance * 64, 255);
         this->led_data[EFLED_EFBAR_OFFSET + i] = (i == idx) ? color_on : color_off.scale8(fade);
     }
-    FastLED.show();
+    this->update();
 }
 
 EFLedClass::LEDPosition EFLedClass::getLEDPosition(const uint8_t idx) {
-    if (idx < std::size(led_positions)) {
-        return led_positions[idx];
+    if (idx < EFLED_TOTAL_NUM) {
+        return {EFLedGeometry::POSITIONS[idx].x, EFLedGeometry::POSITIONS[idx].y};
     }
     return {0, 0};  // Returning default position (0, 0) for out-of-bounds
 }
@@ -206,7 +588,17 @@ void EFLedClass::fillEFBarProportionally(
     for (uint8_t i = num_leds_on; i < EFLED_EFBAR_NUM; i++) {
         this->led_data[EFLED_EFBAR_OFFSET + i] = color_off;
     }
-    FastLED.show();
+    this->update();
+}
+
+EFLedFrameGuard::EFLedFrameGuard(EFLedClass& led)
+: led(led)
+{
+    this->led.beginFrame();
+}
+
+EFLedFrameGuard::~EFLedFrameGuard() {
+    this->led.commitFrame();
 }
 
 #if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLED)
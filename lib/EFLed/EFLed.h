@@ -32,6 +32,11 @@
 
 #include <FastLED.h>
 
+#include "EFLedCompositor.h"
+#include "EFLedOutput.h"
+#include "EFLedOutputStage.h"
+#include "EFLedPowerModel.h"
+
 #define EFLED_PIN_LED_DATA 21
 #define EFLED_PIN_5VBOOST_ENABLE 9
 
@@ -45,6 +50,40 @@
  */
 #define EFLED_MAX_BRIGHTNESS_DEFAULT 50
 
+/**
+ * @brief Default interval in milliseconds after which an unchanged frame is
+ * pushed to the LEDs again, even though it did not change. 0 disables forced
+ * refreshes.
+ */
+#define EFLED_FORCED_REFRESH_MS_DEFAULT 1000
+
+/**
+ * @brief Perceptual delta (see EFLedClass::getFrameDelta()) from which on a
+ * change between two frames is considered visible. 5 / 256 is a relative
+ * change of roughly 2%, which is about the smallest brightness step the eye
+ * picks up.
+ */
+#define EFLED_PERCEPTUAL_DELTA_VISIBLE 5
+
+/**
+ * @brief Wire value added to the reference level of the perceptual delta.
+ * Keeps single PWM steps close to black, which are visible, from counting as
+ * infinitely large changes.
+ */
+#define EFLED_PERCEPTUAL_DELTA_FLOOR 16
+
+/**
+ * @brief Default time in milliseconds all LEDs have to stay black before the
+ * +5V boost converter is switched off automatically. 0 disables power gating.
+ */
+#define EFLED_POWER_GATING_MS_DEFAULT 500
+
+/**
+ * @brief Time in milliseconds the +5V rail needs after enabling the boost
+ * converter before the LEDs accept data
+ */
+#define EFLED_POWER_SETTLE_MS 1
+
 #define EFLED_TOTAL_NUM 17
 #define EFLED_DRAGON_NUM 6
 #define EFLED_EFBAR_NUM 11
@@ -59,6 +98,10 @@
 #define EFLED_DRAGON_EAR_BOTTOM_IDX 4
 #define EFLED_DRAGON_EAR_TOP_IDX 5
 
+constexpr EFLedRegion EFLED_REGION_ALL = {0, EFLED_TOTAL_NUM};
+constexpr EFLedRegion EFLED_REGION_DRAGON = {EFLED_DARGON_OFFSET, EFLED_DRAGON_NUM};
+constexpr EFLedRegion EFLED_REGION_EFBAR = {EFLED_EFBAR_OFFSET, EFLED_EFBAR_NUM};
+
 
 /**
  * @brief Driver for badge LEDs
@@ -69,6 +112,90 @@ class EFLedClass {
 
         CRGB led_data[EFLED_TOTAL_NUM];  //!< Internal LED data structure
         uint8_t max_brightness;  //!< Maximum raw brightness (0-255)
+        uint8_t brightness;      //!< Current raw brightness (0-255)
+        EFLedOutput* output;     //!< Backend used to send frames to the LED strip
+        EFLedOutputStage output_stage;  //!< Gamma, white balance and dithering applied to each pushed frame
+        EFLedCompositor compositor;     //!< Layers composited on top of led_data
+        EFLedPowerModel power_model;  //!< Current estimation for the 5V boost converter
+        uint32_t frame_current_ua;    //!< Estimated current of the last pushed frame in uA
+        uint32_t frames_limited;      //!< Number of frames dimmed to stay within the current budget
+
+        uint8_t frame_depth;     //!< Nesting depth of currently open frame transactions
+        bool frame_pending;      //!< True, if LED data changed inside the currently open frame transaction
+
+        uint32_t last_fingerprint;       //!< Fingerprint of the last frame that was pushed to the strip
+        unsigned long last_push_ms;      //!< Timestamp of the last push to the strip
+        uint16_t forced_refresh_ms;      //!< Interval after which unchanged frames are pushed anyway. 0 = never
+        uint32_t frames_pushed;          //!< Number of frames pushed to the strip since init()
+        uint32_t frames_skipped;         //!< Number of frames skipped since init() because they did not change
+        uint8_t last_wire[EFLED_TOTAL_NUM * 3];  //!< Wire data of the last pushed frame
+        uint8_t frame_delta;                     //!< Perceptual delta of the last show() call
+
+        uint16_t power_gating_ms;        //!< Time LEDs must be black before the boost converter is gated. 0 = never
+        bool power_gated;                //!< True, while the boost converter is switched off due to dark frames
+        unsigned long dark_since_ms;     //!< Timestamp since which all shown frames were black
+        unsigned long gated_since_ms;    //!< Timestamp the boost converter was gated at
+        uint32_t gated_total_ms;         //!< Time the boost converter was gated since init(), excluding the current period
+        uint32_t gated_count;            //!< Number of times the boost converter was gated since init()
+
+        uint8_t led_indices[EFLED_TOTAL_NUM];  //!< Palette index of every LED in indexed mode
+        const CRGB* palette;                   //!< Palette of indexed mode. nullptr, if indexed mode is off.
+        uint16_t palette_len;                  //!< Number of colors in palette
+        uint16_t palette_offset;               //!< Rotation of all indices within the palette
+        EFLedRegion indexed_region;            //!< LEDs driven by the palette in indexed mode
+
+        static bool output_invalidated;  //!< True, if the LEDs might not display the last pushed frame anymore
+
+        /**
+         * @brief Pushes the current LED data to the strip. If a frame transaction
+         * is open, the push is deferred until the outermost commitFrame(). Frames
+         * that are identical to the last pushed frame are skipped.
+         */
+        void show();
+
+        /**
+         * @brief Marks the base layer (led_data) as changed and pushes it to the strip
+         */
+        void update();
+
+        /**
+         * @brief Expands the palette indices of the indexed region into led_data
+         */
+        void expandIndexed();
+
+        /**
+         * @brief Calculates a cheap fingerprint (FNV-1a) over the given frame
+         * and the global brightness
+         *
+         * @param frame Composited LED data
+         * @return Fingerprint of the frame
+         */
+        uint32_t fingerprint(const CRGB* frame) const;
+
+        /**
+         * @brief Computes the perceptual delta between the given wire data and
+         * the wire data of the last pushed frame, see getFrameDelta()
+         */
+        uint8_t perceptualDelta(const uint8_t* wire) const;
+
+        /**
+         * @brief Switches the boost converter off once the LEDs were black for
+         * long enough and back on, before a frame with lit LEDs is pushed
+         *
+         * @param dark True, if the frame about to be shown is completely black
+         * @param shown True, if the frame about to be shown was already pushed
+         */
+        void updatePowerGating(bool dark, bool shown);
+
+        /**
+         * @brief Renders the given frame, scaled by the given brightness,
+         * through the output stage into the given buffer in wire order (GRB)
+         *
+         * @param frame Composited LED data
+         * @param wire Buffer to render into. Must hold EFLED_TOTAL_NUM * 3 bytes.
+         * @param brightness Raw brightness (0-255) to render the frame at
+         */
+        void render(const CRGB* frame, uint8_t* wire, uint8_t brightness);
 
 
     public:
@@ -102,6 +229,29 @@ class EFLedClass {
          */
         void init(const uint8_t absolute_max_brightness);
 
+        /**
+         * @brief Replaces the backend used to send frames to the LED strip.
+         * Must be called before init().
+         *
+         * @param output Output backend to use
+         */
+        void setOutput(EFLedOutput* output);
+
+        /**
+         * @brief Retrieves the backend used to send frames to the LED strip
+         *
+         * @return Current output backend
+         */
+        EFLedOutput* getOutput() const;
+
+        /**
+         * @brief Waits until the last frame was completely sent to the LEDs.
+         * Must be called before the LEDs are unpowered or the CPU goes to sleep.
+         *
+         * @return True, if the output is idle
+         */
+        bool flush();
+
         /**
          * @brief Enables the +5V power domain
          */
@@ -112,11 +262,254 @@ class EFLedClass {
          */
         static void disablePower();
 
+        /**
+         * @brief Sets the time all LEDs have to be black before the +5V boost
+         * converter is switched off automatically. Power is restored right
+         * before the next frame with lit LEDs is pushed.
+         *
+         * @param gating_ms Time in milliseconds. 0 disables automatic power gating.
+         */
+        void setPowerGating(uint16_t gating_ms);
+
+        /**
+         * @brief Determines if the boost converter is currently switched off
+         * due to dark frames
+         *
+         * @return True, if the +5V power domain is gated
+         */
+        bool isPowerGated() const;
+
+        /**
+         * @brief Retrieves the time the boost converter was switched off due to
+         * dark frames since init()
+         *
+         * @return Total gated time in milliseconds
+         */
+        uint32_t getPowerGatedMs() const;
+
+        /**
+         * @brief Retrieves how often the boost converter was switched off due
+         * to dark frames since init()
+         *
+         * @return Number of gating periods
+         */
+        uint32_t getPowerGatedCount() const;
+
         /**
          * @brief Disables all LEDs
          */
         void clear();
 
+        /**
+         * @brief Opens a frame transaction. All LED changes until the matching
+         * commitFrame() are collected and pushed to the strip at once. Frame
+         * transactions can be nested; only the outermost commit pushes.
+         */
+        void beginFrame();
+
+        /**
+         * @brief Closes a frame transaction opened by beginFrame(). If this was
+         * the outermost transaction and LED data changed, the strip is updated
+         * exactly once.
+         */
+        void commitFrame();
+
+        /**
+         * @brief Determines if a frame transaction is currently open
+         *
+         * @return True, if LED changes are currently deferred
+         */
+        bool isFrameOpen() const;
+
+        /**
+         * @brief Retrieves the number of frames pushed to the LED strip since init()
+         *
+         * @return Number of frames handed to the LED output
+         */
+        uint32_t getPushedFrameCount() const;
+
+        /**
+         * @brief Retrieves the number of frames that were not pushed to the LED
+         * strip since init(), because they were identical to the last pushed frame
+         *
+         * @return Number of skipped frames
+         */
+        uint32_t getSkippedFrameCount() const;
+
+        /**
+         * @brief Retrieves how much the last show() call changed what is visible.
+         * For every color channel the difference of the emitted values is taken
+         * relative to their brightness (Weber contrast) and the largest one is
+         * reported. Values below EFLED_PERCEPTUAL_DELTA_VISIBLE are not noticeable.
+         *
+         * @return Perceptual delta in 1/256 of relative change, 0 if the last
+         * frame was skipped because it did not change
+         */
+        uint8_t getFrameDelta() const;
+
+        /**
+         * @brief Sets the interval after which an unchanged frame is pushed to the
+         * LEDs again. This recovers LEDs from glitches on the data line.
+         *
+         * @param interval_ms Refresh interval in milliseconds. 0 disables forced refreshes.
+         */
+        void setForcedRefreshInterval(uint16_t interval_ms);
+
+        /**
+         * @brief Forces the next frame to be pushed to the strip, even if it did
+         * not change
+         */
+        void invalidate();
+
+        /**
+         * @brief Sets a single pixel of a layer above the base layer. Pixels
+         * stay covered until the layer is cleared.
+         *
+         * @param layer Layer to modify
+         * @param idx Index of the LED, relative to the region of the layer
+         * @param color Color to set
+         */
+        void setLayerPixel(EFLedLayer layer, uint8_t idx, const CRGB color);
+
+        /**
+         * @brief Sets all pixels of the region of a layer above the base layer
+         *
+         * @param layer Layer to modify
+         * @param colors Colors to set. Must hold as many colors as the region.
+         */
+        void setLayerPixels(EFLedLayer layer, const CRGB* colors);
+
+        /**
+         * @brief Makes all pixels of a layer transparent, revealing the layers below
+         *
+         * @param layer Layer to clear
+         */
+        void clearLayer(EFLedLayer layer);
+
+        /**
+         * @brief Sets the LEDs a layer applies to, e.g. EFLED_REGION_DRAGON.
+         * Clears the layer.
+         *
+         * @param layer Layer to modify
+         * @param region LEDs the layer applies to
+         */
+        void setLayerRegion(EFLedLayer layer, const EFLedRegion region);
+
+        /**
+         * @brief Sets how a layer is combined with the layers below
+         *
+         * @param layer Layer to modify
+         * @param mode Blend mode to use
+         */
+        void setLayerBlendMode(EFLedLayer layer, EFLedBlendMode mode);
+
+        /**
+         * @brief Sets the opacity of a whole layer
+         *
+         * @param layer Layer to modify
+         * @param opacity Opacity (0 = invisible, 255 = opaque)
+         */
+        void setLayerOpacity(EFLedLayer layer, uint8_t opacity);
+
+        /**
+         * @brief Enables or disables gamma correction (gamma 2.2) of pushed
+         * frames. The current estimation accounts for it.
+         *
+         * @param enabled True, to apply gamma correction
+         */
+        void setGammaCorrection(bool enabled);
+
+        /**
+         * @brief Enables or disables temporal dithering of pushed frames. Dithering
+         * only affects frames that change, static frames are not refreshed for it.
+         *
+         * @param enabled True, to apply temporal dithering
+         */
+        void setDithering(bool enabled);
+
+        /**
+         * @brief Sets the per-channel white balance correction of pushed
+         * frames. The current estimation accounts for it.
+         *
+         * @param correction Correction factor for each channel (255 = unchanged)
+         */
+        void setWhiteBalance(const CRGB correction);
+
+        /**
+         * @brief Sets the maximum current all LEDs are allowed to draw from the
+         * 5V boost converter. Frames that would exceed it are dimmed.
+         *
+         * @param budget_ma Current budget in mA
+         */
+        void setCurrentBudget(uint16_t budget_ma);
+
+        /**
+         * @brief Retrieves the maximum current all LEDs are allowed to draw
+         *
+         * @return Current budget in mA
+         */
+        uint16_t getCurrentBudget() const;
+
+        /**
+         * @brief Retrieves the estimated current drawn by the LEDs for the last pushed frame
+         *
+         * @return Estimated current in mA. 0, while the boost converter is gated.
+         */
+        uint16_t getEstimatedCurrent() const;
+
+        /**
+         * @brief Retrieves the number of frames that were dimmed since init(),
+         * because they would have exceeded the current budget
+         *
+         * @return Number of dimmed frames
+         */
+        uint32_t getLimitedFrameCount() const;
+
+        /**
+         * @brief Switches a region of the LEDs to indexed mode. Each LED of the
+         * region holds an index into a palette and is expanded to RGB once per
+         * pushed frame. While indexed mode is active, the region is owned by
+         * the palette and RGB setters only affect LEDs outside of it.
+         * clear() and clearIndexed() end indexed mode.
+         *
+         * @param region LEDs to drive by the palette
+         * @param indices Palette index of every LED in region
+         * @param palette Colors to index. Not copied, must stay valid while
+         * indexed mode is active.
+         * @param palette_len Number of colors in palette (1-256)
+         */
+        void setIndexed(const EFLedRegion region, const uint8_t* indices, const CRGB* palette, uint16_t palette_len);
+
+        /**
+         * @brief Replaces the palette of indexed mode, e.g. to cycle through
+         * color tables. Keeps the indices and the current offset.
+         *
+         * @param palette Colors to index. Not copied, must stay valid while
+         * indexed mode is active.
+         * @param palette_len Number of colors in palette (1-256)
+         */
+        void setPalette(const CRGB* palette, uint16_t palette_len);
+
+        /**
+         * @brief Rotates the palette of indexed mode. Each LED shows
+         * palette[(index + offset) % palette_len].
+         *
+         * @param offset Rotation of all indices
+         */
+        void setPaletteOffset(uint16_t offset);
+
+        /**
+         * @brief Ends indexed mode. The LEDs keep their last expanded colors.
+         */
+        void clearIndexed();
+
+        /**
+         * @brief Determines if indexed mode is active
+         *
+         * @return True, if a region of the LEDs is driven by a palette
+         */
+        bool isIndexed() const;
+
         /**
          * @brief Sets the global brightness for all LEDs in percent, relative to max brightness
          *
@@ -230,13 +623,51 @@ class EFLedClass {
         void fillEFBarProportionally(uint8_t percent, const CRGB color_on, const CRGB color_off);
 
         /**
-         * @brief Gets the position of the LED in millimeters relative to the upper left corner of the badge
+         * @brief Gets the position of the LED in millimeters relative to the upper left corner of the badge.
+         * See EFLedGeometry.h for precomputed distances and angles.
          *
          * @param idx Number of the LED
          */
         static LEDPosition getLEDPosition(uint8_t idx);
 };
 
+/**
+ * @brief RAII guard for an EFLed frame transaction. Opens a frame on construction
+ * and commits it once the guard goes out of scope.
+ *
+ * Example:
+ * @code
+ * {
+ *     EFLedFrameGuard frame(EFLed);
+ *     EFLed.setDragon(dragon);
+ *     EFLed.setEFBar(bar);
+ * }  // LED strip is pushed exactly once here
+ * @endcode
+ */
+class EFLedFrameGuard {
+
+    protected:
+
+        EFLedClass& led;  //!< EFLed instance the frame transaction was opened on
+
+    public:
+
+        /**
+         * @brief Opens a new frame transaction on the given EFLed instance
+         *
+         * @param led EFLed instance to open the frame transaction on
+         */
+        explicit EFLedFrameGuard(EFLedClass& led);
+
+        /**
+         * @brief Commits the frame transaction opened by this guard
+         */
+        ~EFLedFrameGuard();
+
+        EFLedFrameGuard(const EFLedFrameGuard&) = delete;
+        EFLedFrameGuard& operator=(const EFLedFrameGuard&) = delete;
+};
+
 #if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLED)
 extern EFLedClass EFLed;
 #endif
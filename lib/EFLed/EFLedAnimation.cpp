@@ -0,0 +1,276 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <string.h>
+
+#include <EFLogging.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_partition.h>
+#endif
+
+#include "EFLedAnimation.h"
+
+/**
+ * @brief Rounds the given size up to the animation alignment
+ */
+static size_t alignSize(size_t size) {
+    return (size + EFLED_ANIMATION_ALIGN - 1) & ~((size_t) EFLED_ANIMATION_ALIGN - 1);
+}
+
+/**
+ * @brief Validates an animation header
+ *
+ * @param header Header to check
+ * @param available Number of bytes available for header and data
+ * @return True, if the header describes a playable animation
+ */
+static bool isValidHeader(const EFLedAnimationHeader& header, size_t available) {
+    return header.magic == EFLED_ANIMATION_MAGIC
+        && header.version == EFLED_ANIMATION_VERSION
+        && header.num_leds > 0
+        && header.num_frames > 0
+        && header.data_len <= available - sizeof(EFLedAnimationHeader);
+}
+
+EFLedAnimation::EFLedAnimation()
+: header(nullptr)
+, data(nullptr)
+, pos(0)
+, frame_idx(0)
+{
+}
+
+bool EFLedAnimation::open(const uint8_t* ptr, size_t len) {
+    this->header = nullptr;
+    this->data = nullptr;
+
+    if (!ptr || len < sizeof(EFLedAnimationHeader)) {
+        return false;
+    }
+
+    const EFLedAnimationHeader* header = (const EFLedAnimationHeader*) ptr;
+    if (!isValidHeader(*header, len)) {
+        return false;
+    }
+
+    this->header = header;
+    this->data = ptr + sizeof(EFLedAnimationHeader);
+    this->rewind();
+
+    return true;
+}
+
+bool EFLedAnimation::isOpen() const {
+    return this->header != nullptr;
+}
+
+void EFLedAnimation::rewind() {
+    this->pos = 0;
+    this->frame_idx = 0;
+}
+
+bool EFLedAnimation::nextFrame(CRGB* frame) {
+    if (!this->header) {
+        return false;
+    }
+
+    if (this->frame_idx >= this->header->num_frames) {
+        this->rewind();
+        fill_solid(frame, this->header->num_leds, CRGB::Black);
+    }
+
+    const uint8_t* p = this->data + this->pos;
+    const uint8_t* end = this->data + this->header->data_len;
+    uint8_t led = 0;
+
+    while (led < this->header->num_leds) {
+        if (p >= end) {
+            return false;
+        }
+
+        const uint8_t op = *p & EFLED_ANIMATION_OP_MASK;
+        const uint8_t count = (*p & ~EFLED_ANIMATION_OP_MASK) + 1;
+        p++;
+
+        if (led + count > this->header->num_leds) {
+            return false;
+        }
+
+        switch (op) {
+            case EFLED_ANIMATION_OP_SKIP:
+                break;
+            case EFLED_ANIMATION_OP_FILL:
+                if (end - p < 3) {
+                    return false;
+                }
+                fill_solid(frame + led, count, CRGB(p[0], p[1], p[2]));
+                p += 3;
+                break;
+            case EFLED_ANIMATION_OP_LITERAL:
+                if (end - p < 3 * count) {
+                    return false;
+                }
+                for (uint8_t i = 0; i < count; i++) {
+                    frame[led + i] = CRGB(p[0], p[1], p[2]);
+                    p += 3;
+                }
+                break;
+            default:
+                return false;
+        }
+
+        led += count;
+    }
+
+    this->pos = p - this->data;
+    this->frame_idx++;
+
+    return true;
+}
+
+const char* EFLedAnimation::getName() const {
+    return this->header ? this->header->name : "";
+}
+
+uint8_t EFLedAnimation::getNumLeds() const {
+    return this->header ? this->header->num_leds : 0;
+}
+
+uint16_t EFLedAnimation::getFrameMs() const {
+    return this->header ? this->header->frame_ms : 0;
+}
+
+uint16_t EFLedAnimation::getNumFrames() const {
+    return this->header ? this->header->num_frames : 0;
+}
+
+uint16_t EFLedAnimation::getFrameIdx() const {
+    return this->frame_idx;
+}
+
+size_t EFLedAnimation::getStorageSize() const {
+    if (!this->header) {
+        return 0;
+    }
+
+    return alignSize(sizeof(EFLedAnimationHeader) + this->header->data_len);
+}
+
+EFLedAnimationStoreClass::EFLedAnimationStoreClass()
+: base(nullptr)
+, len(0)
+, offsets()
+, num(0)
+, mmap_handle(0)
+, mapped(false)
+{
+}
+
+void EFLedAnimationStoreClass::scan() {
+    EFLedAnimation animation;
+    size_t offset = 0;
+
+    this->num = 0;
+    while (this->num < EFLED_ANIMATION_STORE_MAX && animation.open(this->base + offset, this->len - offset)) {
+        this->offsets[this->num++] = offset;
+        offset += animation.getStorageSize();
+        if (offset >= this->len) {
+            break;
+        }
+    }
+
+    LOGF_INFO("(EFLedAnimationStore) Found %d animations\r\n", this->num);
+}
+
+bool EFLedAnimationStoreClass::begin() {
+    if (this->mapped) {
+        return true;
+    }
+
+#ifdef ESP_PLATFORM
+    const esp_partition_t* partition = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA,
+        (esp_partition_subtype_t) EFLED_ANIMATION_PARTITION_SUBTYPE,
+        EFLED_ANIMATION_PARTITION_LABEL
+    );
+    if (!partition) {
+        LOG_WARNING("(EFLedAnimationStore) Animation partition not found");
+        return false;
+    }
+
+    // Only map the used part of the partition to preserve MMU pages
+    size_t used = 0;
+    while (used + sizeof(EFLedAnimationHeader) <= partition->size) {
+        EFLedAnimationHeader header;
+        if (esp_partition_read(partition, used, &header, sizeof(header)) != ESP_OK) {
+            break;
+        }
+        if (!isValidHeader(header, partition->size - used)) {
+            break;
+        }
+        used += alignSize(sizeof(EFLedAnimationHeader) + header.data_len);
+    }
+    if (used == 0) {
+        LOG_INFO("(EFLedAnimationStore) Animation partition is empty");
+        return false;
+    }
+
+    const void* ptr = nullptr;
+    spi_flash_mmap_handle_t handle;
+    esp_err_t err = esp_partition_mmap(partition, 0, used, SPI_FLASH_MMAP_DATA, &ptr, &handle);
+    if (err != ESP_OK) {
+        LOGF_ERROR("(EFLedAnimationStore) Failed to map animation partition: %d\r\n", err);
+        return false;
+    }
+
+    this->mmap_handle = handle;
+    this->mapped = true;
+    this->begin((const uint8_t*) ptr, used);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+void EFLedAnimationStoreClass::begin(const uint8_t* ptr, size_t len) {
+    this->base = ptr;
+    this->len = len;
+    this->scan();
+}
+
+uint16_t EFLedAnimationStoreClass::count() const {
+    return this->num;
+}
+
+bool EFLedAnimationStoreClass::open(uint16_t idx, EFLedAnimation& animation) const {
+    if (idx >= this->num) {
+        return false;
+    }
+
+    return animation.open(this->base + this->offsets[idx], this->len - this->offsets[idx]);
+}
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDANIMATIONSTORE)
+EFLedAnimationStoreClass EFLedAnimationStore;
+#endif
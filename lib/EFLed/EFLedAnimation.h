@@ -0,0 +1,242 @@
+#ifndef EFLED_ANIMATION_H_
+#define EFLED_ANIMATION_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <FastLED.h>
+
+/**
+ * @brief Magic number at the start of every animation, "EFAN" in little endian
+ */
+#define EFLED_ANIMATION_MAGIC 0x4E414645
+
+/**
+ * @brief Version of the animation format, see tools/efanim.py
+ */
+#define EFLED_ANIMATION_VERSION 1
+
+/**
+ * @brief Alignment of animations inside the animation partition
+ */
+#define EFLED_ANIMATION_ALIGN 4
+
+/**
+ * @brief Label of the data partition holding all animations
+ */
+#define EFLED_ANIMATION_PARTITION_LABEL "anim"
+
+/**
+ * @brief Subtype of the data partition holding all animations
+ */
+#define EFLED_ANIMATION_PARTITION_SUBTYPE 0x40
+
+/**
+ * @brief Maximum number of animations inside the animation partition
+ */
+#ifndef EFLED_ANIMATION_STORE_MAX
+#define EFLED_ANIMATION_STORE_MAX 64
+#endif
+
+/**
+ * @brief Frame opcodes. The upper two bits of every opcode byte select the
+ * operation, the lower six bits hold the number of affected LEDs minus one.
+ */
+#define EFLED_ANIMATION_OP_MASK    0xC0
+#define EFLED_ANIMATION_OP_SKIP    0x00  //!< Keep the LEDs of the previous frame
+#define EFLED_ANIMATION_OP_FILL    0x40  //!< Set the LEDs to the single color that follows
+#define EFLED_ANIMATION_OP_LITERAL 0x80  //!< Set the LEDs to the colors that follow, one per LED
+
+/**
+ * @brief Header in front of every animation. All fields are little endian.
+ */
+struct __attribute__((packed)) EFLedAnimationHeader {
+    uint32_t magic;       //!< Must be EFLED_ANIMATION_MAGIC
+    uint8_t version;      //!< Must be EFLED_ANIMATION_VERSION
+    uint8_t num_leds;     //!< Number of LEDs per frame
+    uint16_t frame_ms;    //!< Duration of a single frame in milliseconds
+    uint16_t num_frames;  //!< Number of frames
+    uint16_t reserved;    //!< Reserved, must be 0
+    uint32_t data_len;    //!< Number of bytes of frame data following the header
+    char name[16];        //!< Human readable name, zero padded
+};
+
+static_assert(sizeof(EFLedAnimationHeader) == 32, "Animation header layout changed");
+
+/**
+ * @brief Zero-copy player of a single animation in memory mapped flash
+ *
+ * Every frame is coded as a sequence of opcodes relative to the previous
+ * frame until all LEDs are covered. The first frame is relative to all LEDs
+ * being black. Playback loops after the last frame.
+ */
+class EFLedAnimation {
+
+    protected:
+
+        const EFLedAnimationHeader* header;  //!< Header of the animation or nullptr
+        const uint8_t* data;                 //!< Start of frame data
+        size_t pos;                          //!< Offset of the next frame inside data
+        uint16_t frame_idx;                  //!< Index of the next frame
+
+    public:
+
+        /**
+         * @brief Constructs an empty animation
+         */
+        EFLedAnimation();
+
+        /**
+         * @brief Attaches to the animation at the given address
+         *
+         * @param ptr Start of the animation header. Must stay valid while playing.
+         * @param len Number of bytes available at ptr
+         * @return True, if a valid animation was found
+         */
+        bool open(const uint8_t* ptr, size_t len);
+
+        /**
+         * @brief Determines if an animation is attached
+         *
+         * @return True, if open() succeeded
+         */
+        bool isOpen() const;
+
+        /**
+         * @brief Restarts playback at the first frame
+         */
+        void rewind();
+
+        /**
+         * @brief Decodes the next frame on top of the previous one. Wraps
+         * around to the first frame after the last one.
+         *
+         * @param frame Frame to update. Must hold getNumLeds() colors and
+         * contain the previous frame, or black after rewind().
+         * @return True on success, false if the frame data is corrupt
+         */
+        bool nextFrame(CRGB* frame);
+
+        /**
+         * @brief Provides access to the name of the animation
+         *
+         * @return Name, at most 16 characters, not necessarily zero terminated
+         */
+        const char* getName() const;
+
+        /**
+         * @brief Provides access to the number of LEDs per frame
+         */
+        uint8_t getNumLeds() const;
+
+        /**
+         * @brief Provides access to the duration of a single frame
+         */
+        uint16_t getFrameMs() const;
+
+        /**
+         * @brief Provides access to the number of frames
+         */
+        uint16_t getNumFrames() const;
+
+        /**
+         * @brief Provides access to the index of the next frame
+         */
+        uint16_t getFrameIdx() const;
+
+        /**
+         * @brief Determines the number of bytes the attached animation occupies
+         * inside the animation partition, including header and padding
+         *
+         * @return Size in bytes or 0, if no animation is attached
+         */
+        size_t getStorageSize() const;
+};
+
+/**
+ * @brief Index of all animations inside the animation partition
+ *
+ * Animations are stored back to back, each aligned to EFLED_ANIMATION_ALIGN.
+ * The first word without a valid magic number, usually erased flash, ends the
+ * list. Only the used part of the partition is memory mapped.
+ */
+class EFLedAnimationStoreClass {
+
+    protected:
+
+        const uint8_t* base;                           //!< Start of the mapped animations
+        size_t len;                                    //!< Number of mapped bytes
+        uint32_t offsets[EFLED_ANIMATION_STORE_MAX];   //!< Offset of every animation relative to base
+        uint16_t num;                                  //!< Number of animations
+        uint32_t mmap_handle;                          //!< Handle of the flash mapping
+        bool mapped;                                   //!< True, if the partition is mapped
+
+        /**
+         * @brief Builds the index of all animations inside the given memory
+         */
+        void scan();
+
+    public:
+
+        EFLedAnimationStoreClass();
+
+        /**
+         * @brief Maps the animation partition into memory and indexes it.
+         * Does nothing, if the partition is already mapped.
+         *
+         * @return True, if the partition was found and mapped
+         */
+        bool begin();
+
+        /**
+         * @brief Indexes animations inside an arbitrary memory area
+         *
+         * @param ptr Start of the animations
+         * @param len Number of bytes available at ptr
+         */
+        void begin(const uint8_t* ptr, size_t len);
+
+        /**
+         * @brief Provides access to the number of stored animations
+         *
+         * @return Number of valid animations
+         */
+        uint16_t count() const;
+
+        /**
+         * @brief Attaches the given player to a stored animation
+         *
+         * @param idx Index of the animation
+         * @param animation Player to attach
+         * @return True on success
+         */
+        bool open(uint16_t idx, EFLedAnimation& animation) const;
+};
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDANIMATIONSTORE)
+extern EFLedAnimationStoreClass EFLedAnimationStore;
+#endif
+
+#endif /* EFLED_ANIMATION_H_ */
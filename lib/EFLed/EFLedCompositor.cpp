@@ -0,0 +1,188 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <string.h>
+
+#include "EFLedCompositor.h"
+
+EFLedCompositor::EFLedCompositor()
+: num_leds(0)
+{
+    this->init(0);
+}
+
+void EFLedCompositor::init(uint8_t num_leds) {
+    this->num_leds = num_leds < EFLED_COMPOSITOR_MAX_LEDS ? num_leds : EFLED_COMPOSITOR_MAX_LEDS;
+
+    for (Layer& layer : this->layers) {
+        layer.region = {0, this->num_leds};
+        layer.mode = EFLedBlendMode::Replace;
+        layer.opacity = 255;
+        memset(layer.mask, 0, sizeof(layer.mask));
+        layer.empty = true;
+        layer.dirty = true;
+    }
+    this->layers[(uint8_t) EFLedLayer::Overlay].mode = EFLedBlendMode::Alpha;
+}
+
+EFLedCompositor::Layer* EFLedCompositor::get(EFLedLayer layer) {
+    if (layer == EFLedLayer::Base || layer >= EFLedLayer::COUNT) {
+        return nullptr;
+    }
+    return &this->layers[(uint8_t) layer];
+}
+
+void EFLedCompositor::markBaseDirty() {
+    this->layers[(uint8_t) EFLedLayer::Base].dirty = true;
+}
+
+void EFLedCompositor::setRegion(EFLedLayer layer, const EFLedRegion region) {
+    Layer* l = this->get(layer);
+    if (!l || region.offset + region.num > this->num_leds) {
+        return;
+    }
+
+    l->region = region;
+    this->clear(layer);
+}
+
+void EFLedCompositor::setBlendMode(EFLedLayer layer, EFLedBlendMode mode) {
+    Layer* l = this->get(layer);
+    if (!l || l->mode == mode) {
+        return;
+    }
+
+    l->mode = mode;
+    l->dirty = true;
+}
+
+void EFLedCompositor::setOpacity(EFLedLayer layer, uint8_t opacity) {
+    Layer* l = this->get(layer);
+    if (!l || l->opacity == opacity) {
+        return;
+    }
+
+    l->opacity = opacity;
+    l->dirty = true;
+}
+
+void EFLedCompositor::setPixel(EFLedLayer layer, uint8_t idx, const CRGB color, uint8_t coverage) {
+    Layer* l = this->get(layer);
+    if (!l || idx >= l->region.num) {
+        return;
+    }
+
+    l->pixels[l->region.offset + idx] = color;
+    l->mask[l->region.offset + idx] = coverage;
+    l->empty = false;
+    l->dirty = true;
+}
+
+void EFLedCompositor::setPixels(EFLedLayer layer, const CRGB* colors) {
+    Layer* l = this->get(layer);
+    if (!l) {
+        return;
+    }
+
+    memcpy(&l->pixels[l->region.offset], colors, l->region.num * sizeof(CRGB));
+    memset(&l->mask[l->region.offset], 255, l->region.num);
+    l->empty = false;
+    l->dirty = true;
+}
+
+void EFLedCompositor::clear(EFLedLayer layer) {
+    Layer* l = this->get(layer);
+    if (!l || l->empty) {
+        return;
+    }
+
+    memset(l->mask, 0, sizeof(l->mask));
+    l->empty = true;
+    l->dirty = true;
+}
+
+bool EFLedCompositor::isActive() const {
+    for (uint8_t i = 1; i < (uint8_t) EFLedLayer::COUNT; i++) {
+        if (!this->layers[i].empty && this->layers[i].opacity > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void EFLedCompositor::blend(const CRGB* below, const Layer& layer, CRGB* out) const {
+    memcpy(out, below, this->num_leds * sizeof(CRGB));
+    if (layer.empty || layer.opacity == 0) {
+        return;
+    }
+
+    for (uint8_t i = layer.region.offset; i < layer.region.offset + layer.region.num; i++) {
+        const uint8_t coverage = ((uint16_t) layer.mask[i] * (layer.opacity + 1)) >> 8;
+        if (coverage == 0) {
+            continue;
+        }
+
+        const CRGB& src = layer.pixels[i];
+        switch (layer.mode) {
+            case EFLedBlendMode::Replace:
+                // Partially covered pixels fade, e.g. while a layer is faded in
+                out[i] = coverage == 255 ? src : ::blend(below[i], src, coverage);
+                break;
+            case EFLedBlendMode::Add:
+                out[i] += CRGB(src).nscale8(coverage);
+                break;
+            case EFLedBlendMode::Alpha:
+                out[i] = ::blend(below[i], src, coverage);
+                break;
+            case EFLedBlendMode::Multiply:
+                out[i] = ::blend(
+                    below[i],
+                    CRGB(scale8(below[i].r, src.r), scale8(below[i].g, src.g), scale8(below[i].b, src.b)),
+                    coverage
+                );
+                break;
+        }
+    }
+}
+
+const CRGB* EFLedCompositor::compose(const CRGB* base) {
+    if (!this->isActive()) {
+        // Cache is bypassed and needs to be rebuilt once a layer becomes visible again
+        this->markBaseDirty();
+        return base;
+    }
+
+    bool dirty = this->layers[(uint8_t) EFLedLayer::Base].dirty;
+    this->layers[(uint8_t) EFLedLayer::Base].dirty = false;
+
+    const CRGB* below = base;
+    for (uint8_t i = 1; i < (uint8_t) EFLedLayer::COUNT; i++) {
+        dirty |= this->layers[i].dirty;
+        if (dirty) {
+            this->blend(below, this->layers[i], this->cache[i]);
+            this->layers[i].dirty = false;
+        }
+        below = this->cache[i];
+    }
+
+    return below;
+}
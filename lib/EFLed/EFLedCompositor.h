@@ -0,0 +1,198 @@
+#ifndef EFLED_COMPOSITOR_H_
+#define EFLED_COMPOSITOR_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include <FastLED.h>
+
+/**
+ * @brief Maximum number of LEDs the compositor can hold
+ */
+#ifndef EFLED_COMPOSITOR_MAX_LEDS
+#define EFLED_COMPOSITOR_MAX_LEDS 21
+#endif
+
+/**
+ * @brief Layers, from bottom to top. The base layer is the regular LED data of
+ * EFLed. All other layers are composited on top of it.
+ */
+enum class EFLedLayer : uint8_t {
+    Base,      //!< Regular LED data, usually the animation of the current state
+    Overlay,   //!< Decorations on top of the animation
+    Feedback,  //!< Short user feedback, e.g. lock indicator or brightness changes
+    Warning,   //!< Warnings that must always be visible, e.g. low battery
+    COUNT
+};
+
+/**
+ * @brief Modes to combine a layer with the layers below it
+ */
+enum class EFLedBlendMode : uint8_t {
+    Replace,   //!< Fully covered pixels replace the pixels below, partially covered ones are blended
+    Add,       //!< Pixels are added to the pixels below
+    Alpha,     //!< Pixels are blended over the pixels below by their coverage
+    Multiply,  //!< Pixels below are multiplied with the layer pixels
+};
+
+/**
+ * @brief Consecutive range of LEDs
+ */
+struct EFLedRegion {
+    uint8_t offset;  //!< Index of the first LED
+    uint8_t num;     //!< Number of LEDs
+};
+
+/**
+ * @brief Composites layers of LED data into a single frame
+ *
+ * Each layer covers a region of the LEDs. Only pixels that were set since the
+ * layer was cleared are covered; all others are transparent. The result of
+ * every layer is cached, so that a change to a layer only re-composites that
+ * layer and the ones above it.
+ */
+class EFLedCompositor {
+
+    protected:
+
+        /**
+         * @brief Content and settings of a single layer
+         */
+        struct Layer {
+            CRGB pixels[EFLED_COMPOSITOR_MAX_LEDS];  //!< Colors of all LEDs, absolute indices
+            uint8_t mask[EFLED_COMPOSITOR_MAX_LEDS];  //!< Coverage of all LEDs (0 = transparent)
+            EFLedRegion region;                       //!< LEDs this layer applies to
+            EFLedBlendMode mode;                      //!< How this layer is combined with the layers below
+            uint8_t opacity;                          //!< Opacity of the whole layer
+            bool empty;                               //!< True, if no pixel is covered
+            bool dirty;                               //!< True, if the layer changed since the last compose()
+        };
+
+        uint8_t num_leds;                                  //!< Number of LEDs per layer
+        Layer layers[(uint8_t) EFLedLayer::COUNT];         //!< All layers. Pixels of the base layer are unused.
+        CRGB cache[(uint8_t) EFLedLayer::COUNT][EFLED_COMPOSITOR_MAX_LEDS];  //!< Composited result up to each layer
+
+        /**
+         * @brief Retrieves the given layer, if it can be modified
+         *
+         * @return Pointer to the layer or nullptr for the base layer
+         */
+        Layer* get(EFLedLayer layer);
+
+        /**
+         * @brief Composites a single layer over the given pixels
+         *
+         * @param below Result of all layers below
+         * @param layer Layer to composite
+         * @param out Buffer to write the result to
+         */
+        void blend(const CRGB* below, const Layer& layer, CRGB* out) const;
+
+    public:
+
+        /**
+         * @brief Constructs a new compositor with all layers cleared
+         */
+        EFLedCompositor();
+
+        /**
+         * @brief Resets all layers to their defaults
+         *
+         * @param num_leds Number of LEDs per layer. At most EFLED_COMPOSITOR_MAX_LEDS.
+         */
+        void init(uint8_t num_leds);
+
+        /**
+         * @brief Marks the base layer as changed
+         */
+        void markBaseDirty();
+
+        /**
+         * @brief Sets the LEDs the given layer applies to. Clears the layer.
+         *
+         * @param layer Layer to modify
+         * @param region LEDs the layer applies to
+         */
+        void setRegion(EFLedLayer layer, const EFLedRegion region);
+
+        /**
+         * @brief Sets how the given layer is combined with the layers below
+         *
+         * @param layer Layer to modify
+         * @param mode Blend mode to use
+         */
+        void setBlendMode(EFLedLayer layer, EFLedBlendMode mode);
+
+        /**
+         * @brief Sets the opacity of the whole layer
+         *
+         * @param layer Layer to modify
+         * @param opacity Opacity (0 = invisible, 255 = opaque)
+         */
+        void setOpacity(EFLedLayer layer, uint8_t opacity);
+
+        /**
+         * @brief Sets a single pixel of the given layer
+         *
+         * @param layer Layer to modify
+         * @param idx Index of the LED, relative to the region of the layer
+         * @param color Color to set
+         * @param coverage Coverage of the pixel (0 = transparent, 255 = opaque)
+         */
+        void setPixel(EFLedLayer layer, uint8_t idx, const CRGB color, uint8_t coverage = 255);
+
+        /**
+         * @brief Sets all pixels of the region of the given layer
+         *
+         * @param layer Layer to modify
+         * @param colors Colors to set. Must hold as many colors as the region.
+         */
+        void setPixels(EFLedLayer layer, const CRGB* colors);
+
+        /**
+         * @brief Makes all pixels of the given layer transparent
+         *
+         * @param layer Layer to clear
+         */
+        void clear(EFLedLayer layer);
+
+        /**
+         * @brief Determines if any layer above the base layer is visible
+         *
+         * @return True, if compose() has to blend layers
+         */
+        bool isActive() const;
+
+        /**
+         * @brief Composites all layers on top of the given base layer. Only
+         * layers that changed, and all layers above them, are composited again.
+         *
+         * @param base LED data of the base layer
+         * @return Composited frame. Either base or an internal buffer that stays
+         * valid until the next call.
+         */
+        const CRGB* compose(const CRGB* base);
+};
+
+#endif /* EFLED_COMPOSITOR_H_ */
@@ -0,0 +1,156 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <Arduino.h>
+
+#include "EFLedEffects.h"
+
+EFLedEffectQueueClass::EFLedEffectQueueClass()
+: steps()
+, head(0)
+, num(0)
+, active(false)
+, step_start_ms(0)
+{
+}
+
+EFLedEffectStep* EFLedEffectQueueClass::reserve() {
+    if (this->num >= EFLED_EFFECT_QUEUE_SIZE) {
+        return nullptr;
+    }
+
+    EFLedEffectStep* step = &this->steps[(this->head + this->num) % EFLED_EFFECT_QUEUE_SIZE];
+    this->num++;
+    return step;
+}
+
+bool EFLedEffectQueueClass::push(
+    const EFLedRegion region,
+    const CRGB* pixels,
+    uint16_t duration_ms,
+    uint8_t brightness_percent
+) {
+    EFLedEffectStep* step = this->reserve();
+    if (!step) {
+        return false;
+    }
+
+    step->region = region;
+    for (uint8_t i = 0; i < region.num && i < EFLED_TOTAL_NUM; i++) {
+        step->pixels[i] = pixels[i];
+    }
+    step->duration_ms = duration_ms;
+    step->brightness_percent = brightness_percent;
+
+    return true;
+}
+
+bool EFLedEffectQueueClass::pushSolid(const EFLedRegion region, const CRGB color, uint16_t duration_ms) {
+    CRGB pixels[EFLED_TOTAL_NUM];
+    fill_solid(pixels, EFLED_TOTAL_NUM, color);
+    return this->push(region, pixels, duration_ms);
+}
+
+bool EFLedEffectQueueClass::pushBar(
+    uint8_t num_on,
+    const CRGB color_on,
+    const CRGB color_off,
+    uint16_t duration_ms,
+    uint8_t brightness_percent
+) {
+    CRGB pixels[EFLED_EFBAR_NUM];
+    for (uint8_t i = 0; i < EFLED_EFBAR_NUM; i++) {
+        pixels[i] = i < num_on ? color_on : color_off;
+    }
+    return this->push(EFLED_REGION_EFBAR, pixels, duration_ms, brightness_percent);
+}
+
+bool EFLedEffectQueueClass::pushBlink(
+    const EFLedRegion region,
+    const CRGB color,
+    uint8_t count,
+    uint16_t on_ms,
+    uint16_t off_ms
+) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (!this->pushSolid(region, color, on_ms) || !this->pushSolid(region, CRGB::Black, off_ms)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EFLedEffectQueueClass::update() {
+    const uint32_t now = millis();
+
+    if (this->active) {
+        if (now - this->step_start_ms < this->steps[this->head].duration_ms) {
+            return;
+        }
+
+        // Current step is over
+        this->head = (this->head + 1) % EFLED_EFFECT_QUEUE_SIZE;
+        this->num--;
+        this->active = false;
+
+        if (this->num == 0) {
+            EFLedFrameGuard frame(EFLed);
+            EFLed.setLayerRegion(EFLedLayer::Feedback, EFLED_REGION_ALL);
+            return;
+        }
+    }
+
+    if (this->num == 0) {
+        return;
+    }
+
+    const EFLedEffectStep& step = this->steps[this->head];
+    {
+        EFLedFrameGuard frame(EFLed);
+        EFLed.setLayerRegion(EFLedLayer::Feedback, step.region);
+        EFLed.setLayerPixels(EFLedLayer::Feedback, step.pixels);
+        if (step.brightness_percent > 0) {
+            EFLed.setBrightnessPercent(step.brightness_percent);
+        }
+    }
+
+    this->active = true;
+    this->step_start_ms = now;
+}
+
+void EFLedEffectQueueClass::clear() {
+    this->head = 0;
+    this->num = 0;
+
+    if (this->active) {
+        this->active = false;
+        EFLed.setLayerRegion(EFLedLayer::Feedback, EFLED_REGION_ALL);
+    }
+}
+
+bool EFLedEffectQueueClass::isActive() const {
+    return this->num > 0;
+}
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDEFFECTS)
+EFLedEffectQueueClass EFLedEffects;
+#endif
@@ -0,0 +1,151 @@
+#ifndef EFLED_EFFECTS_H_
+#define EFLED_EFFECTS_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include <FastLED.h>
+
+#include "EFLed.h"
+
+/**
+ * @brief Maximum number of queued effect steps
+ */
+#ifndef EFLED_EFFECT_QUEUE_SIZE
+#define EFLED_EFFECT_QUEUE_SIZE 32
+#endif
+
+/**
+ * @brief A single timed step of a feedback effect
+ */
+struct EFLedEffectStep {
+    EFLedRegion region;              //!< LEDs covered during this step
+    CRGB pixels[EFLED_TOTAL_NUM];    //!< Colors of the covered LEDs, relative to region
+    uint16_t duration_ms;            //!< Time this step is shown
+    uint8_t brightness_percent;      //!< LED brightness to apply at the start of this step, 0 to keep
+};
+
+/**
+ * @brief Queue of short, timed feedback effects
+ *
+ * Event handlers enqueue effects and return immediately. The queue is advanced
+ * periodically by update() and shows the current step on the feedback layer,
+ * on top of the running animation. Once the queue runs empty, the feedback
+ * layer is cleared again.
+ */
+class EFLedEffectQueueClass {
+
+    protected:
+
+        EFLedEffectStep steps[EFLED_EFFECT_QUEUE_SIZE];  //!< Ring buffer of queued steps
+        uint8_t head;                                    //!< Index of the current step
+        uint8_t num;                                     //!< Number of queued steps, including the current one
+        bool active;                                     //!< True, if the current step is shown
+        uint32_t step_start_ms;                          //!< Time the current step was shown
+
+        /**
+         * @brief Reserves the next free step
+         *
+         * @return Step to fill or nullptr, if the queue is full
+         */
+        EFLedEffectStep* reserve();
+
+    public:
+
+        EFLedEffectQueueClass();
+
+        /**
+         * @brief Enqueues a single step showing the given pixels
+         *
+         * @param region LEDs to cover
+         * @param pixels Colors of the covered LEDs. Must hold region.num colors.
+         * @param duration_ms Time to show the step
+         * @param brightness_percent LED brightness to apply, 0 to keep
+         * @return True, if the step was queued
+         */
+        bool push(const EFLedRegion region, const CRGB* pixels, uint16_t duration_ms, uint8_t brightness_percent = 0);
+
+        /**
+         * @brief Enqueues a single step filling a region with a single color
+         *
+         * @param region LEDs to cover
+         * @param color Color of the covered LEDs
+         * @param duration_ms Time to show the step
+         * @return True, if the step was queued
+         */
+        bool pushSolid(const EFLedRegion region, const CRGB color, uint16_t duration_ms);
+
+        /**
+         * @brief Enqueues a single step showing a level on the EF bar
+         *
+         * @param num_on Number of LEDs, starting at the first EF bar LED, to show color_on
+         * @param color_on Color of the first num_on LEDs
+         * @param color_off Color of the remaining LEDs
+         * @param duration_ms Time to show the step
+         * @param brightness_percent LED brightness to apply, 0 to keep
+         * @return True, if the step was queued
+         */
+        bool pushBar(
+            uint8_t num_on,
+            const CRGB color_on,
+            const CRGB color_off,
+            uint16_t duration_ms,
+            uint8_t brightness_percent = 0
+        );
+
+        /**
+         * @brief Enqueues a blinking region
+         *
+         * @param region LEDs to blink
+         * @param color Color while on
+         * @param count Number of blinks
+         * @param on_ms Time the region is on per blink
+         * @param off_ms Time the region is off per blink
+         * @return True, if all steps were queued
+         */
+        bool pushBlink(const EFLedRegion region, const CRGB color, uint8_t count, uint16_t on_ms, uint16_t off_ms);
+
+        /**
+         * @brief Advances the queue. Must be called periodically, e.g. every FSM tick.
+         */
+        void update();
+
+        /**
+         * @brief Drops all queued steps and clears the feedback layer
+         */
+        void clear();
+
+        /**
+         * @brief Determines if an effect is currently shown or queued
+         *
+         * @return True, if any step is pending
+         */
+        bool isActive() const;
+};
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDEFFECTS)
+extern EFLedEffectQueueClass EFLedEffects;
+#endif
+
+#endif /* EFLED_EFFECTS_H_ */
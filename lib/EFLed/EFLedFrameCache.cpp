@@ -0,0 +1,188 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdlib.h>
+
+#include <EFHeap.h>
+#include <EFLogging.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_heap_caps.h>
+#endif
+
+#include "EFLedFrameCache.h"
+
+EFLedFrameCacheClass::EFLedFrameCacheClass()
+: entries()
+, uncached()
+, scratch()
+, enabled(true)
+, use_counter(0)
+, hits(0)
+, misses(0)
+{
+}
+
+EFLedFrameCacheClass::~EFLedFrameCacheClass() {
+    this->clear();
+}
+
+void* EFLedFrameCacheClass::allocate(size_t bytes) {
+    // Filling the cache is a deliberate one-off allocation per animation
+    EFHeapUntrackedScope untracked;
+#ifdef ESP_PLATFORM
+    void* ptr = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (ptr) {
+        return ptr;
+    }
+#endif
+    return malloc(bytes);
+}
+
+void EFLedFrameCacheClass::release(Entry& entry) {
+    EFHeapUntrackedScope untracked;
+    free(entry.frames);
+    entry.frames = nullptr;
+    entry.renderer = nullptr;
+}
+
+bool EFLedFrameCacheClass::matches(
+    const Entry& entry,
+    EFLedFrameRenderer renderer,
+    uint32_t param,
+    uint16_t period,
+    uint8_t num_leds
+) {
+    return (
+        entry.renderer == renderer &&
+        entry.param == param &&
+        entry.period == period &&
+        entry.num_leds == num_leds
+    );
+}
+
+EFLedFrameCacheClass::Entry& EFLedFrameCacheClass::evict() {
+    Entry* lru = &this->entries[0];
+    for (Entry& entry : this->entries) {
+        if (!entry.frames) {
+            return entry;
+        }
+        if (entry.last_used < lru->last_used) {
+            lru = &entry;
+        }
+    }
+
+    release(*lru);
+    return *lru;
+}
+
+const CRGB* EFLedFrameCacheClass::get(
+    EFLedFrameRenderer renderer,
+    uint32_t param,
+    uint16_t period,
+    uint8_t num_leds,
+    uint32_t tick
+) {
+    if (!this->enabled) {
+        renderer(tick, param, this->scratch);
+        return this->scratch;
+    }
+    if (num_leds > EFLED_FRAME_CACHE_MAX_LEDS) {
+        num_leds = EFLED_FRAME_CACHE_MAX_LEDS;
+    }
+    if (period == 0) {
+        period = 1;
+    }
+    const uint16_t idx = tick % period;
+
+    for (Entry& entry : this->entries) {
+        if (entry.frames && matches(entry, renderer, param, period, num_leds)) {
+            entry.last_used = ++this->use_counter;
+            this->hits++;
+            return entry.frames + idx * num_leds;
+        }
+    }
+
+    // Do not try again to cache an animation that failed before
+    if (matches(this->uncached, renderer, param, period, num_leds)) {
+        renderer(idx, param, this->scratch);
+        return this->scratch;
+    }
+
+    this->misses++;
+
+    // Render live if the animation is too long or memory is exhausted. Cached
+    // animations are only evicted once the memory for the new one is available.
+    CRGB* frames = nullptr;
+    if (period <= EFLED_FRAME_CACHE_MAX_FRAMES) {
+        frames = (CRGB*) allocate(sizeof(CRGB) * period * num_leds);
+    }
+    if (!frames) {
+        LOGF_DEBUG("(EFLedFrameCache) Can not cache %d frames. Rendering live.\r\n", period);
+        this->uncached = {renderer, param, period, num_leds, 0, nullptr};
+        renderer(idx, param, this->scratch);
+        return this->scratch;
+    }
+
+    Entry& entry = this->evict();
+    entry.frames = frames;
+    entry.renderer = renderer;
+    entry.param = param;
+    entry.period = period;
+    entry.num_leds = num_leds;
+    entry.last_used = ++this->use_counter;
+    for (uint16_t i = 0; i < period; i++) {
+        renderer(i, param, entry.frames + i * num_leds);
+    }
+    LOGF_DEBUG("(EFLedFrameCache) Cached %d frames of %d LEDs\r\n", period, num_leds);
+
+    return entry.frames + idx * num_leds;
+}
+
+void EFLedFrameCacheClass::clear() {
+    for (Entry& entry : this->entries) {
+        if (entry.frames) {
+            release(entry);
+        }
+    }
+    this->uncached = {};
+}
+
+void EFLedFrameCacheClass::setEnabled(bool enabled) {
+    this->enabled = enabled;
+}
+
+bool EFLedFrameCacheClass::isEnabled() const {
+    return this->enabled;
+}
+
+uint32_t EFLedFrameCacheClass::getHitCount() const {
+    return this->hits;
+}
+
+uint32_t EFLedFrameCacheClass::getMissCount() const {
+    return this->misses;
+}
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDFRAMECACHE)
+EFLedFrameCacheClass EFLedFrameCache;
+#endif
@@ -0,0 +1,199 @@
+#ifndef EFLED_FRAME_CACHE_H_
+#define EFLED_FRAME_CACHE_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <FastLED.h>
+
+/**
+ * @brief Number of animations the cache holds at the same time
+ */
+#ifndef EFLED_FRAME_CACHE_SLOTS
+#define EFLED_FRAME_CACHE_SLOTS 8
+#endif
+
+/**
+ * @brief Maximum number of frames a single animation may consist of
+ */
+#ifndef EFLED_FRAME_CACHE_MAX_FRAMES
+#define EFLED_FRAME_CACHE_MAX_FRAMES 512
+#endif
+
+/**
+ * @brief Maximum number of LEDs per cached frame
+ */
+#ifndef EFLED_FRAME_CACHE_MAX_LEDS
+#define EFLED_FRAME_CACHE_MAX_LEDS 21
+#endif
+
+/**
+ * @brief Renders a single frame of a deterministic, periodic animation
+ *
+ * @param tick Index of the frame to render
+ * @param param Everything besides tick the output depends on, e.g. a hue index
+ * @param out Buffer to write the frame to
+ */
+typedef void (*EFLedFrameRenderer)(uint32_t tick, uint32_t param, CRGB* out);
+
+/**
+ * @brief Cache of fully pre-rendered periodic animations
+ *
+ * On the first request for an animation, all frames of its period are
+ * rendered at once and stored, preferably in PSRAM. Subsequent requests are
+ * served by index without calling the renderer again. Animations are
+ * identified by their renderer and param. The least recently used animation
+ * is evicted if all slots are taken, but only once the memory for the new
+ * animation was allocated. If memory can not be allocated, frames are rendered
+ * live instead. Caching that animation is not tried again until another one
+ * failed or clear() was called.
+ */
+class EFLedFrameCacheClass {
+
+    protected:
+
+        /**
+         * @brief A single cached animation
+         */
+        struct Entry {
+            EFLedFrameRenderer renderer;  //!< Renderer the frames were created with
+            uint32_t param;               //!< Param the frames were created with
+            uint16_t period;              //!< Number of frames
+            uint8_t num_leds;             //!< Number of LEDs per frame
+            uint32_t last_used;           //!< Value of use_counter at the last access
+            CRGB* frames;                 //!< All frames, or nullptr if the slot is free
+        };
+
+        Entry entries[EFLED_FRAME_CACHE_SLOTS];  //!< Cached animations
+        Entry uncached;                          //!< Last animation that could not be cached, without frames
+        CRGB scratch[EFLED_FRAME_CACHE_MAX_LEDS];  //!< Live rendered frame, if caching is impossible
+        bool enabled;                            //!< False, if all frames are rendered live
+        uint32_t use_counter;                    //!< Monotonic counter for LRU bookkeeping
+        uint32_t hits;                           //!< Number of frames served from the cache
+        uint32_t misses;                         //!< Number of animations that had to be rendered
+
+        /**
+         * @brief Allocates frame memory, preferably in PSRAM
+         *
+         * @param bytes Number of bytes to allocate
+         * @return Pointer to the memory or nullptr on failure
+         */
+        static void* allocate(size_t bytes);
+
+        /**
+         * @brief Releases all frames of the given entry
+         */
+        static void release(Entry& entry);
+
+        /**
+         * @brief Determines if the given entry holds the given animation
+         *
+         * @return True, if renderer, param, period and num_leds match
+         */
+        static bool matches(
+            const Entry& entry,
+            EFLedFrameRenderer renderer,
+            uint32_t param,
+            uint16_t period,
+            uint8_t num_leds
+        );
+
+        /**
+         * @brief Finds a free slot or evicts the least recently used one
+         *
+         * @return Slot to use for a new animation
+         */
+        Entry& evict();
+
+    public:
+
+        EFLedFrameCacheClass();
+        ~EFLedFrameCacheClass();
+
+        EFLedFrameCacheClass(const EFLedFrameCacheClass&) = delete;
+        EFLedFrameCacheClass& operator=(const EFLedFrameCacheClass&) = delete;
+
+        /**
+         * @brief Retrieves a single frame of the given animation. Renders and
+         * caches the whole period on first use.
+         *
+         * @param renderer Function to render the frames with. Must be deterministic.
+         * @param param Everything besides tick the output of renderer depends on
+         * @param period Number of ticks after which the animation repeats
+         * @param num_leds Number of LEDs per frame
+         * @param tick Current tick of the animation. Wraps around at period.
+         * @return Frame of num_leds colors. Valid until the next call.
+         */
+        const CRGB* get(
+            EFLedFrameRenderer renderer,
+            uint32_t param,
+            uint16_t period,
+            uint8_t num_leds,
+            uint32_t tick
+        );
+
+        /**
+         * @brief Drops all cached animations and frees their memory. Animations
+         * that could not be cached before are tried again.
+         */
+        void clear();
+
+        /**
+         * @brief Enables or disables the cache. While disabled, every frame is
+         * rendered live from the unwrapped tick, as done without the cache.
+         * Cached animations are kept.
+         *
+         * @param enabled True, to serve frames from the cache
+         */
+        void setEnabled(bool enabled);
+
+        /**
+         * @brief Determines if frames are served from the cache
+         *
+         * @return True, if the cache is enabled
+         */
+        bool isEnabled() const;
+
+        /**
+         * @brief Provides access to the number of frames served from the cache
+         *
+         * @return Number of cache hits
+         */
+        uint32_t getHitCount() const;
+
+        /**
+         * @brief Provides access to the number of animations that had to be
+         * rendered, including the ones that could not be cached
+         *
+         * @return Number of cache misses
+         */
+        uint32_t getMissCount() const;
+};
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDFRAMECACHE)
+extern EFLedFrameCacheClass EFLedFrameCache;
+#endif
+
+#endif /* EFLED_FRAME_CACHE_H_ */
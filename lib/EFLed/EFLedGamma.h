@@ -0,0 +1,88 @@
+#ifndef EFLED_GAMMA_H_
+#define EFLED_GAMMA_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <array>
+#include <stdint.h>
+
+/**
+ * @brief Compile-time generation of gamma correction tables
+ */
+namespace EFLedGamma {
+
+    /**
+     * @brief Calculates the n-th root of v (0 <= v <= 1) using Newton's method
+     */
+    constexpr double root(double v, unsigned int n) {
+        if (v <= 0.0) {
+            return 0.0;
+        }
+
+        double r = 1.0;
+        for (unsigned int iter = 0; iter < 200; iter++) {
+            double r_pow = 1.0;
+            for (unsigned int i = 0; i < n - 1; i++) {
+                r_pow *= r;
+            }
+            r = ((n - 1) * r + v / r_pow) / n;
+        }
+        return r;
+    }
+
+    /**
+     * @brief Calculates x^(num/den) for 0 <= x <= 1
+     */
+    constexpr double power(double x, unsigned int num, unsigned int den) {
+        double x_pow = 1.0;
+        for (unsigned int i = 0; i < num; i++) {
+            x_pow *= x;
+        }
+        return root(x_pow, den);
+    }
+
+    /**
+     * @brief Generates a gamma table mapping 8 bit input values to 8.8 fixed
+     * point output values (0 - 255 << 8)
+     *
+     * @tparam NUM Numerator of the gamma exponent
+     * @tparam DEN Denominator of the gamma exponent
+     */
+    template<unsigned int NUM, unsigned int DEN>
+    constexpr std::array<uint16_t, 256> table() {
+        std::array<uint16_t, 256> lut = {0};
+        for (unsigned int i = 0; i < 256; i++) {
+            lut[i] = (uint16_t) (power(i / 255.0, NUM, DEN) * (255 << 8) + 0.5);
+        }
+        return lut;
+    }
+
+}
+
+/**
+ * @brief Gamma 2.2 table mapping 8 bit input values to 8.8 fixed point output
+ * values. Generated at compile time and placed in flash.
+ */
+inline constexpr std::array<uint16_t, 256> EFLED_GAMMA22_LUT = EFLedGamma::table<11, 5>();
+
+#endif /* EFLED_GAMMA_H_ */
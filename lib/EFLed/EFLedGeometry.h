@@ -0,0 +1,265 @@
+#ifndef EFLED_GEOMETRY_H_
+#define EFLED_GEOMETRY_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include "EFLed.h"
+
+/**
+ * @brief Physical layout of the badge LEDs. All tables are generated at compile
+ * time from the LED positions, so spatial effects can use lookups instead of
+ * float math at runtime.
+ *
+ * Coordinates and distances are in millimeters, relative to the upper left
+ * corner of the badge. Angles are in 1/256 of a full turn (0 = right, 64 = down),
+ * which matches FastLED's sin8() / cos8().
+ */
+namespace EFLedGeometry {
+
+    /**
+     * @brief Point on the badge in millimeters
+     */
+    struct Point {
+        int16_t x;  //!< X coordinate in millimeters
+        int16_t y;  //!< Y coordinate in millimeters
+    };
+
+    /**
+     * @brief Positions of all LEDs
+     */
+    constexpr Point POSITIONS[EFLED_TOTAL_NUM] = {
+        {17, 126},  // 0
+        {21, 106},
+        {23, 91},
+        {41, 86},
+        {35, 48},
+        {37, 43},  // 5
+        {61, 15},
+        {61, 27},
+        {61, 41},
+        {61, 54},
+        {61, 67},  // 10
+        {61, 79},
+        {61, 93},
+        {61, 105},
+        {61, 118},
+        {61, 131},  // 15
+        {61, 144}
+    };
+
+    /**
+     * @brief Named reference points on the badge
+     */
+    enum class Anchor : uint8_t {
+        Center,       //!< Center of the bounding box of all LEDs
+        Eye,          //!< Dragon eye LED
+        PowerButton,  //!< Power button
+        Hand,         //!< Hand of the dragon, left of the power button
+        COUNT
+    };
+
+    namespace detail {
+
+        constexpr double sqrt(double v) {
+            if (v <= 0.0) {
+                return 0.0;
+            }
+            double r = v > 1.0 ? v : 1.0;
+            for (uint8_t i = 0; i < 64; i++) {
+                r = (r + v / r) / 2;
+            }
+            return r;
+        }
+
+        constexpr double atan(double z) {
+            // Halve the argument until the series converges quickly
+            if (z > 0.25 || z < -0.25) {
+                return 2 * atan(z / (1 + sqrt(1 + z * z)));
+            }
+            double sum = 0.0;
+            double term = z;
+            for (uint8_t n = 0; n < 16; n++) {
+                sum += term / (2 * n + 1);
+                term *= -z * z;
+            }
+            return sum;
+        }
+
+        constexpr double atan2(double y, double x) {
+            constexpr double pi = 3.14159265358979323846;
+            if (x > 0) {
+                return atan(y / x);
+            } else if (x < 0) {
+                return atan(y / x) + (y >= 0 ? pi : -pi);
+            }
+            return y > 0 ? pi / 2 : (y < 0 ? -pi / 2 : 0.0);
+        }
+
+        constexpr uint8_t distance(const Point a, const Point b) {
+            const double dx = a.x - b.x;
+            const double dy = a.y - b.y;
+            const double d = sqrt(dx * dx + dy * dy) + 0.5;
+            return d > 255 ? 255 : (uint8_t) d;
+        }
+
+        constexpr uint8_t angle(const Point origin, const Point p) {
+            constexpr double pi = 3.14159265358979323846;
+            const double a = atan2(p.y - origin.y, p.x - origin.x);
+            return (uint8_t) ((int16_t) (a / (2 * pi) * 256 + 256.5) % 256);
+        }
+
+        constexpr Point center() {
+            int16_t min_x = POSITIONS[0].x, max_x = POSITIONS[0].x;
+            int16_t min_y = POSITIONS[0].y, max_y = POSITIONS[0].y;
+            for (const Point p : POSITIONS) {
+                min_x = p.x < min_x ? p.x : min_x;
+                max_x = p.x > max_x ? p.x : max_x;
+                min_y = p.y < min_y ? p.y : min_y;
+                max_y = p.y > max_y ? p.y : max_y;
+            }
+            return {(int16_t) ((min_x + max_x) / 2), (int16_t) ((min_y + max_y) / 2)};
+        }
+
+        template<typename T, size_t N>
+        struct Table {
+            T data[N];
+
+            constexpr T operator[](size_t i) const {
+                return data[i];
+            }
+        };
+
+        template<size_t N>
+        using Row = Table<uint8_t, N>;
+
+        constexpr Table<Row<EFLED_TOTAL_NUM>, EFLED_TOTAL_NUM> pairwiseDistances() {
+            Table<Row<EFLED_TOTAL_NUM>, EFLED_TOTAL_NUM> table = {};
+            for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+                for (uint8_t j = 0; j < EFLED_TOTAL_NUM; j++) {
+                    table.data[i].data[j] = distance(POSITIONS[i], POSITIONS[j]);
+                }
+            }
+            return table;
+        }
+
+        constexpr Row<EFLED_TOTAL_NUM> distancesFrom(const Point origin) {
+            Row<EFLED_TOTAL_NUM> row = {};
+            for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+                row.data[i] = distance(origin, POSITIONS[i]);
+            }
+            return row;
+        }
+
+        constexpr Row<EFLED_TOTAL_NUM> anglesFrom(const Point origin) {
+            Row<EFLED_TOTAL_NUM> row = {};
+            for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+                row.data[i] = angle(origin, POSITIONS[i]);
+            }
+            return row;
+        }
+
+        template<typename Key>
+        constexpr Row<EFLED_TOTAL_NUM> sortedBy(Key key) {
+            Row<EFLED_TOTAL_NUM> order = {};
+            for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+                order.data[i] = i;
+            }
+            // Insertion sort keeps LEDs with equal keys in index order
+            for (uint8_t i = 1; i < EFLED_TOTAL_NUM; i++) {
+                for (uint8_t j = i; j > 0 && key(POSITIONS[order.data[j]]) < key(POSITIONS[order.data[j - 1]]); j--) {
+                    const uint8_t tmp = order.data[j];
+                    order.data[j] = order.data[j - 1];
+                    order.data[j - 1] = tmp;
+                }
+            }
+            return order;
+        }
+
+    }
+
+    /**
+     * @brief Center of the bounding box of all LEDs
+     */
+    constexpr Point CENTER = detail::center();
+
+    /**
+     * @brief Positions of all anchors, indexed by Anchor
+     */
+    constexpr Point ANCHORS[(uint8_t) Anchor::COUNT] = {
+        CENTER,
+        POSITIONS[EFLED_DRAGON_EYE_IDX],
+        {11, 25},
+        {-30, 16},
+    };
+
+    /**
+     * @brief Distances between every pair of LEDs: PAIRWISE_DISTANCE[a][b]
+     */
+    constexpr auto PAIRWISE_DISTANCE = detail::pairwiseDistances();
+
+    /**
+     * @brief Distance of every LED from CENTER
+     */
+    constexpr auto RADIUS = detail::distancesFrom(CENTER);
+
+    /**
+     * @brief Angle of every LED around CENTER
+     */
+    constexpr auto ANGLE = detail::anglesFrom(CENTER);
+
+    /**
+     * @brief Distances of every LED from every anchor: ANCHOR_DISTANCE[anchor][led]
+     */
+    constexpr detail::Table<detail::Row<EFLED_TOTAL_NUM>, (uint8_t) Anchor::COUNT> ANCHOR_DISTANCE = {{
+        detail::distancesFrom(ANCHORS[(uint8_t) Anchor::Center]),
+        detail::distancesFrom(ANCHORS[(uint8_t) Anchor::Eye]),
+        detail::distancesFrom(ANCHORS[(uint8_t) Anchor::PowerButton]),
+        detail::distancesFrom(ANCHORS[(uint8_t) Anchor::Hand]),
+    }};
+
+    /**
+     * @brief LED indices sorted from left to right. LEDs with equal X keep their index order.
+     */
+    constexpr auto BY_X = detail::sortedBy([](const Point p) { return p.x; });
+
+    /**
+     * @brief LED indices sorted from top to bottom. LEDs with equal Y keep their index order.
+     */
+    constexpr auto BY_Y = detail::sortedBy([](const Point p) { return p.y; });
+
+    /**
+     * @brief Retrieves the distance of an LED from the given anchor
+     *
+     * @param anchor Anchor to measure from
+     * @param idx Number of the LED
+     * @return Distance in millimeters
+     */
+    constexpr uint8_t distanceFrom(const Anchor anchor, const uint8_t idx) {
+        return ANCHOR_DISTANCE[(uint8_t) anchor][idx];
+    }
+
+}
+
+#endif /* EFLED_GEOMETRY_H_ */
@@ -0,0 +1,137 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <Arduino.h>
+
+#include "EFLedOutput.h"
+
+EFLedOutput::EFLedOutput(uint16_t latch_us)
+: buffers({{0}})
+, back(0)
+, num_bytes(0)
+, latch_us(latch_us)
+, busy(false)
+, last_complete_us(0)
+, callback(nullptr)
+, callback_ctx(nullptr)
+, frames_submitted(0)
+, frames_completed(0)
+, fence_waits(0)
+, fence_timeouts(0)
+{
+}
+
+bool EFLedOutput::begin(uint8_t pin, uint16_t num_bytes) {
+    if (num_bytes > EFLED_OUTPUT_MAX_BYTES) {
+        return false;
+    }
+
+    this->num_bytes = num_bytes;
+    this->back = 0;
+    this->busy = false;
+    return true;
+}
+
+uint8_t* EFLedOutput::backBuffer() {
+    return this->buffers[this->back];
+}
+
+uint16_t EFLedOutput::getFrameSize() const {
+    return this->num_bytes;
+}
+
+bool EFLedOutput::submit() {
+    // Fence: The other buffer is still in flight until the backend completed it
+    if (this->busy) {
+        this->fence_waits++;
+        if (!this->wait(EFLED_OUTPUT_FENCE_TIMEOUT_MS)) {
+            this->fence_timeouts++;
+            return false;
+        }
+    }
+
+    // LEDs only latch the data after the line idled for a while
+    while ((uint32_t) micros() - this->last_complete_us < this->latch_us) {
+    }
+
+    this->busy = true;
+    if (!this->transmit(this->buffers[this->back], this->num_bytes)) {
+        this->busy = false;
+        return false;
+    }
+
+    this->frames_submitted++;
+    this->back ^= 1;
+    return true;
+}
+
+bool EFLedOutput::flush(uint32_t timeout_ms) {
+    return !this->busy || this->wait(timeout_ms);
+}
+
+bool EFLedOutput::wait(uint32_t timeout_ms) {
+    const unsigned long start = millis();
+    while (this->busy) {
+        if (millis() - start >= timeout_ms) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void EFLedOutput::onComplete() {
+    this->last_complete_us = micros();
+    this->frames_completed++;
+    this->busy = false;
+    if (this->callback) {
+        this->callback(this->callback_ctx);
+    }
+}
+
+bool EFLedOutput::isBusy() const {
+    return this->busy;
+}
+
+void EFLedOutput::setCompletionCallback(EFLedOutputCallback callback, void* ctx) {
+    this->callback_ctx = ctx;
+    this->callback = callback;
+}
+
+uint32_t EFLedOutput::getSubmittedFrameCount() const {
+    return this->frames_submitted;
+}
+
+uint32_t EFLedOutput::getCompletedFrameCount() const {
+    return this->frames_completed;
+}
+
+uint32_t EFLedOutput::getLastCompleteMicros() const {
+    return this->last_complete_us;
+}
+
+uint32_t EFLedOutput::getFenceWaitCount() const {
+    return this->fence_waits;
+}
+
+uint32_t EFLedOutput::getFenceTimeoutCount() const {
+    return this->fence_timeouts;
+}
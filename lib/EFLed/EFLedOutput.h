@@ -0,0 +1,204 @@
+#ifndef EFLED_OUTPUT_H_
+#define EFLED_OUTPUT_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief Maximum number of bytes a single frame can hold on the wire (3 bytes per LED)
+ */
+#ifndef EFLED_OUTPUT_MAX_BYTES
+#define EFLED_OUTPUT_MAX_BYTES 64
+#endif
+
+/**
+ * @brief Maximum time in milliseconds submit() waits for the previous frame to finish
+ */
+#define EFLED_OUTPUT_FENCE_TIMEOUT_MS 5
+
+/**
+ * @brief Callback that is invoked once a frame was completely sent to the LEDs.
+ * Might be called from ISR context!
+ */
+typedef void (*EFLedOutputCallback)(void* ctx);
+
+/**
+ * @brief Double buffered output backend for the LED strip
+ *
+ * Frames are rendered into the back buffer as raw bytes in wire order and
+ * handed over to the backend via submit(). submit() returns as soon as the
+ * backend started to transmit. The transmitted buffer stays untouched until
+ * the backend signals completion, while the next frame can already be rendered
+ * into the other buffer (fence).
+ */
+class EFLedOutput {
+
+    protected:
+
+        uint8_t buffers[2][EFLED_OUTPUT_MAX_BYTES];  //!< Front and back buffer
+        uint8_t back;                                //!< Index of the current back buffer
+        uint16_t num_bytes;                          //!< Number of bytes per frame
+        uint16_t latch_us;                           //!< Minimum idle time between two frames
+
+        std::atomic<bool> busy;                      //!< True, while a frame is transmitted
+        std::atomic<uint32_t> last_complete_us;      //!< Timestamp of the last completed frame
+
+        EFLedOutputCallback callback;                //!< Callback to invoke once a frame completed
+        void* callback_ctx;                          //!< Context to pass to the callback
+
+        uint32_t frames_submitted;                   //!< Number of frames handed to the backend
+        std::atomic<uint32_t> frames_completed;      //!< Number of frames completely sent
+        uint32_t fence_waits;                        //!< Number of submits that had to wait for the previous frame
+        uint32_t fence_timeouts;                     //!< Number of submits that were dropped because the previous frame did not finish
+
+        /**
+         * @brief Starts transmitting the given data. Must not block until the
+         * transmission is complete. Backends have to call onComplete() once
+         * the data was sent.
+         *
+         * @param data Data to send in wire order
+         * @param len Number of bytes to send
+         * @return True, if the transmission was started
+         */
+        virtual bool transmit(const uint8_t* data, uint16_t len) = 0;
+
+        /**
+         * @brief Blocks until the frame currently in flight was completely sent
+         *
+         * @param timeout_ms Maximum time to wait
+         * @return True, if no frame is in flight anymore
+         */
+        virtual bool wait(uint32_t timeout_ms);
+
+        /**
+         * @brief Signals that the frame in flight was completely sent. Safe to
+         * call from ISR context.
+         */
+        void onComplete();
+
+    public:
+
+        /**
+         * @brief Constructs a new output backend
+         *
+         * @param latch_us Minimum time in microseconds the data line has to idle between two frames
+         */
+        explicit EFLedOutput(uint16_t latch_us);
+
+        virtual ~EFLedOutput() = default;
+
+        /**
+         * @brief Initializes the backend hardware
+         *
+         * @param pin Data pin of the LED strip
+         * @param num_bytes Number of bytes per frame
+         * @return True, if the backend is ready to transmit
+         */
+        virtual bool begin(uint8_t pin, uint16_t num_bytes);
+
+        /**
+         * @brief Retrieves the buffer the next frame should be rendered into
+         *
+         * @return Pointer to getFrameSize() bytes
+         */
+        uint8_t* backBuffer();
+
+        /**
+         * @brief Retrieves the number of bytes per frame
+         *
+         * @return Number of bytes per frame
+         */
+        uint16_t getFrameSize() const;
+
+        /**
+         * @brief Hands the back buffer over to the backend and swaps buffers.
+         * Waits for the previous frame to finish, if it is still in flight.
+         *
+         * @return True, if the frame is being sent, false if it was dropped
+         */
+        bool submit();
+
+        /**
+         * @brief Waits until the frame in flight was completely sent
+         *
+         * @param timeout_ms Maximum time to wait
+         * @return True, if no frame is in flight anymore
+         */
+        bool flush(uint32_t timeout_ms = EFLED_OUTPUT_FENCE_TIMEOUT_MS);
+
+        /**
+         * @brief Determines if a frame is currently being sent
+         *
+         * @return True, if a frame is in flight
+         */
+        bool isBusy() const;
+
+        /**
+         * @brief Sets the callback that is invoked once a frame was completely
+         * sent. The callback might be called from ISR context!
+         *
+         * @param callback Function to call or nullptr to remove the callback
+         * @param ctx Context pointer passed to the callback
+         */
+        void setCompletionCallback(EFLedOutputCallback callback, void* ctx = nullptr);
+
+        /**
+         * @brief Retrieves the number of frames handed to the backend
+         *
+         * @return Number of submitted frames
+         */
+        uint32_t getSubmittedFrameCount() const;
+
+        /**
+         * @brief Retrieves the number of frames that were completely sent
+         *
+         * @return Number of completed frames
+         */
+        uint32_t getCompletedFrameCount() const;
+
+        /**
+         * @brief Retrieves the time the last frame was completely sent at
+         *
+         * @return Timestamp in microseconds since boot
+         */
+        uint32_t getLastCompleteMicros() const;
+
+        /**
+         * @brief Retrieves the number of submits that had to wait for the previous frame
+         *
+         * @return Number of fence waits
+         */
+        uint32_t getFenceWaitCount() const;
+
+        /**
+         * @brief Retrieves the number of frames that were dropped, because the
+         * previous frame did not finish in time
+         *
+         * @return Number of fence timeouts
+         */
+        uint32_t getFenceTimeoutCount() const;
+};
+
+#endif /* EFLED_OUTPUT_H_ */
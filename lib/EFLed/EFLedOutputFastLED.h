@@ -0,0 +1,74 @@
+#ifndef EFLED_OUTPUT_FASTLED_H_
+#define EFLED_OUTPUT_FASTLED_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <string.h>
+
+#include <FastLED.h>
+
+#include "EFLedOutput.h"
+
+/**
+ * @brief Blocking output backend that sends frames using FastLED.show().
+ * Frames are complete as soon as submit() returns.
+ *
+ * @tparam PIN Data pin of the LED strip
+ */
+template<uint8_t PIN>
+class EFLedOutputFastLED : public EFLedOutput {
+
+    protected:
+
+        CRGB leds[EFLED_OUTPUT_MAX_BYTES / 3];  //!< LED data handed to FastLED
+
+        bool transmit(const uint8_t* data, uint16_t len) override {
+            memcpy(this->leds, data, len);
+            FastLED.show();
+            this->onComplete();
+            return true;
+        }
+
+    public:
+
+        EFLedOutputFastLED()
+        : EFLedOutput(0)
+        , leds({0})
+        {
+        }
+
+        bool begin(uint8_t pin, uint16_t num_bytes) override {
+            if (!EFLedOutput::begin(pin, num_bytes)) {
+                return false;
+            }
+
+            // Frames are already brightness scaled and in wire order
+            FastLED.clearData();
+            FastLED.addLeds<WS2812B, PIN, RGB>(this->leds, num_bytes / 3);
+            FastLED.setBrightness(255);
+            FastLED.setDither(DISABLE_DITHER);
+            return true;
+        }
+};
+
+#endif /* EFLED_OUTPUT_FASTLED_H_ */
@@ -0,0 +1,109 @@
+#ifndef EFLED_OUTPUT_MOCK_H_
+#define EFLED_OUTPUT_MOCK_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <string.h>
+
+#include "EFLedOutput.h"
+
+/**
+ * @brief Output backend that records frames instead of sending them. Used to
+ * run the LED code on a host.
+ *
+ * If auto completion is disabled, frames stay in flight until complete() is
+ * called, which allows to step through the buffer swap and fence logic.
+ */
+class EFLedOutputMock : public EFLedOutput {
+
+    protected:
+
+        bool auto_complete;                          //!< Complete frames right after transmit()
+        uint8_t last_frame[EFLED_OUTPUT_MAX_BYTES];  //!< Copy of the last transmitted frame
+        const uint8_t* in_flight;                    //!< Buffer that is currently transmitted
+
+        bool transmit(const uint8_t* data, uint16_t len) override {
+            memcpy(this->last_frame, data, len);
+            this->in_flight = data;
+            if (this->auto_complete) {
+                this->complete();
+            }
+            return true;
+        }
+
+        bool wait(uint32_t timeout_ms) override {
+            return !this->busy;
+        }
+
+    public:
+
+        /**
+         * @brief Constructs a new mock backend
+         *
+         * @param auto_complete True, if frames should complete immediately
+         */
+        explicit EFLedOutputMock(bool auto_complete = true)
+        : EFLedOutput(0)
+        , auto_complete(auto_complete)
+        , last_frame({0})
+        , in_flight(nullptr)
+        {
+        }
+
+        /**
+         * @brief Completes the frame currently in flight
+         */
+        void complete() {
+            this->in_flight = nullptr;
+            this->onComplete();
+        }
+
+        /**
+         * @brief Sets if frames should complete immediately
+         *
+         * @param auto_complete True, if frames should complete right after transmit()
+         */
+        void setAutoComplete(bool auto_complete) {
+            this->auto_complete = auto_complete;
+        }
+
+        /**
+         * @brief Retrieves the last transmitted frame
+         *
+         * @return Pointer to getFrameSize() bytes in wire order
+         */
+        const uint8_t* getLastFrame() const {
+            return this->last_frame;
+        }
+
+        /**
+         * @brief Retrieves the buffer that is currently in flight
+         *
+         * @return Pointer to the buffer being transmitted or nullptr
+         */
+        const uint8_t* getInFlightBuffer() const {
+            return this->in_flight;
+        }
+};
+
+#endif /* EFLED_OUTPUT_MOCK_H_ */
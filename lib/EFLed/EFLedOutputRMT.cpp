@@ -0,0 +1,139 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifdef ESP_PLATFORM
+
+#include <Arduino.h>
+
+#include <EFLogging.h>
+
+#include "EFLedOutputRMT.h"
+
+// WS2812B bit timings in ns
+#define WS2812B_T0H_NS 400
+#define WS2812B_T0L_NS 850
+#define WS2812B_T1H_NS 800
+#define WS2812B_T1L_NS 450
+
+static rmt_item32_t ws2812b_bit0;
+static rmt_item32_t ws2812b_bit1;
+
+/**
+ * @brief Translates frame bytes into RMT items, MSB first. Called by the RMT
+ * driver whenever the channel memory needs to be refilled.
+ */
+static void IRAM_ATTR ws2812b_translate(
+    const void* src,
+    rmt_item32_t* dest,
+    size_t src_size,
+    size_t wanted_num,
+    size_t* translated_size,
+    size_t* item_num
+) {
+    const uint8_t* psrc = (const uint8_t*) src;
+    size_t size = 0;
+    size_t num = 0;
+
+    while (size < src_size && num + 8 <= wanted_num) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            dest[num++] = (*psrc & (0x80 >> bit)) ? ws2812b_bit1 : ws2812b_bit0;
+        }
+        size++;
+        psrc++;
+    }
+
+    *translated_size = size;
+    *item_num = num;
+}
+
+EFLedOutputRMT::EFLedOutputRMT(rmt_channel_t channel)
+: EFLedOutput(EFLED_OUTPUT_RMT_LATCH_US)
+, channel(channel)
+, pm_lock(nullptr)
+{
+}
+
+bool EFLedOutputRMT::begin(uint8_t pin, uint16_t num_bytes) {
+    if (!EFLedOutput::begin(pin, num_bytes)) {
+        return false;
+    }
+
+    rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t) pin, this->channel);
+    config.clk_div = 2;
+    config.mem_block_num = 2;
+    if (rmt_config(&config) != ESP_OK || rmt_driver_install(this->channel, 0, 0) != ESP_OK) {
+        LOGF_ERROR("(EFLedOutputRMT) Failed to initialize RMT channel %d\r\n", this->channel);
+        return false;
+    }
+
+    uint32_t counter_clk_hz = 0;
+    rmt_get_counter_clock(this->channel, &counter_clk_hz);
+    const float ticks_per_ns = counter_clk_hz / 1e9;
+    ws2812b_bit0 = {{{ (uint32_t) (ticks_per_ns * WS2812B_T0H_NS), 1, (uint32_t) (ticks_per_ns * WS2812B_T0L_NS), 0 }}};
+    ws2812b_bit1 = {{{ (uint32_t) (ticks_per_ns * WS2812B_T1H_NS), 1, (uint32_t) (ticks_per_ns * WS2812B_T1L_NS), 0 }}};
+
+    // Automatic light sleep would stop the RMT clock in the middle of a frame.
+    // Fails if the framework was built without power management, which is fine.
+    if (esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "efled_rmt", &this->pm_lock) != ESP_OK) {
+        this->pm_lock = nullptr;
+    }
+
+    rmt_translator_init(this->channel, ws2812b_translate);
+    rmt_register_tx_end_callback(EFLedOutputRMT::onTxEnd, this);
+    LOGF_DEBUG("(EFLedOutputRMT) Initialized RMT channel %d @ PIN %d\r\n", this->channel, pin);
+
+    return true;
+}
+
+bool EFLedOutputRMT::transmit(const uint8_t* data, uint16_t len) {
+    if (this->pm_lock) {
+        esp_pm_lock_acquire(this->pm_lock);
+    }
+    if (rmt_write_sample(this->channel, data, len, false) != ESP_OK) {
+        if (this->pm_lock) {
+            esp_pm_lock_release(this->pm_lock);
+        }
+        return false;
+    }
+    return true;
+}
+
+bool EFLedOutputRMT::wait(uint32_t timeout_ms) {
+    if (rmt_wait_tx_done(this->channel, pdMS_TO_TICKS(timeout_ms)) != ESP_OK) {
+        return false;
+    }
+
+    // The TX end callback is invoked right after the driver released the TX semaphore
+    return EFLedOutput::wait(1);
+}
+
+void IRAM_ATTR EFLedOutputRMT::onTxEnd(rmt_channel_t channel, void* arg) {
+    EFLedOutputRMT* self = (EFLedOutputRMT*) arg;
+    if (channel == self->channel) {
+        if (self->pm_lock) {
+            esp_pm_lock_release(self->pm_lock);
+        }
+        self->onComplete();
+    }
+}
+
+#endif /* ESP_PLATFORM */
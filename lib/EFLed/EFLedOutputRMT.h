@@ -0,0 +1,72 @@
+#ifndef EFLED_OUTPUT_RMT_H_
+#define EFLED_OUTPUT_RMT_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#ifdef ESP_PLATFORM
+
+#include <driver/rmt.h>
+#include <esp_pm.h>
+
+#include "EFLedOutput.h"
+
+/**
+ * @brief Reset time the WS2812B needs to latch a frame
+ */
+#define EFLED_OUTPUT_RMT_LATCH_US 280
+
+/**
+ * @brief Output backend that sends frames to WS2812B LEDs using the RMT
+ * peripheral. Bits are translated into RMT items on the fly from within the RMT
+ * interrupt, so submit() returns right after the first block was queued.
+ */
+class EFLedOutputRMT : public EFLedOutput {
+
+    protected:
+
+        const rmt_channel_t channel;  //!< RMT channel used for transmission
+        esp_pm_lock_handle_t pm_lock; //!< Keeps the chip out of light sleep while a frame is sent
+
+        bool transmit(const uint8_t* data, uint16_t len) override;
+        bool wait(uint32_t timeout_ms) override;
+
+        /**
+         * @brief Handles the RMT TX end interrupt
+         */
+        static void onTxEnd(rmt_channel_t channel, void* arg);
+
+    public:
+
+        /**
+         * @brief Constructs a new RMT output backend
+         *
+         * @param channel RMT TX channel to use
+         */
+        explicit EFLedOutputRMT(rmt_channel_t channel);
+
+        bool begin(uint8_t pin, uint16_t num_bytes) override;
+};
+
+#endif /* ESP_PLATFORM */
+
+#endif /* EFLED_OUTPUT_RMT_H_ */
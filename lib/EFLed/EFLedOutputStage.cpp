@@ -0,0 +1,102 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <string.h>
+
+#include "EFLedGamma.h"
+#include "EFLedOutputStage.h"
+
+EFLedOutputStage::EFLedOutputStage()
+: gamma(false)
+, dithering(true)
+, white_balance(CRGB(255, 255, 255))
+, residue({{0}})
+{
+}
+
+void EFLedOutputStage::setGammaCorrection(bool enabled) {
+    this->gamma = enabled;
+}
+
+bool EFLedOutputStage::isGammaCorrection() const {
+    return this->gamma;
+}
+
+void EFLedOutputStage::setDithering(bool enabled) {
+    this->dithering = enabled;
+    this->reset();
+}
+
+bool EFLedOutputStage::isDithering() const {
+    return this->dithering;
+}
+
+void EFLedOutputStage::setWhiteBalance(const CRGB correction) {
+    this->white_balance = correction;
+}
+
+CRGB EFLedOutputStage::getWhiteBalance() const {
+    return this->white_balance;
+}
+
+void EFLedOutputStage::reset() {
+    memset(this->residue, 0, sizeof(this->residue));
+}
+
+/**
+ * @brief Converts a 0-255 scale into a 0-256 factor. 0 stays 0, so dithering
+ * never lights up LEDs that are switched off.
+ */
+static inline uint16_t scaleFactor(uint8_t scale) {
+    return scale ? scale + 1 : 0;
+}
+
+void EFLedOutputStage::render(const CRGB* leds, uint8_t num, uint8_t brightness, uint8_t* wire) {
+    // Combined white balance and brightness factor per channel (GRB), 0 - 256 * 256
+    const uint32_t scale[3] = {
+        (uint32_t) scaleFactor(this->white_balance.g) * scaleFactor(brightness),
+        (uint32_t) scaleFactor(this->white_balance.r) * scaleFactor(brightness),
+        (uint32_t) scaleFactor(this->white_balance.b) * scaleFactor(brightness),
+    };
+
+    if (num > EFLED_OUTPUT_STAGE_MAX_LEDS) {
+        num = EFLED_OUTPUT_STAGE_MAX_LEDS;
+    }
+    for (uint8_t i = 0; i < num; i++) {
+        const uint8_t channels[3] = {leds[i].g, leds[i].r, leds[i].b};
+        for (uint8_t c = 0; c < 3; c++) {
+            // 8.8 fixed point intensity
+            const uint32_t linear = this->gamma ? EFLED_GAMMA22_LUT[channels[c]] : channels[c] << 8;
+            const uint16_t value = (linear * scale[c]) >> 16;
+
+            uint8_t out = value >> 8;
+            if (this->dithering) {
+                const uint16_t acc = this->residue[i][c] + (value & 0xFF);
+                if (acc >= 256 && out < 255) {
+                    out++;
+                }
+                this->residue[i][c] = acc & 0xFF;
+            }
+            *wire++ = out;
+        }
+    }
+}
@@ -0,0 +1,119 @@
+#ifndef EFLED_OUTPUT_STAGE_H_
+#define EFLED_OUTPUT_STAGE_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include <FastLED.h>
+
+/**
+ * @brief Maximum number of LEDs the output stage keeps dithering state for
+ */
+#ifndef EFLED_OUTPUT_STAGE_MAX_LEDS
+#define EFLED_OUTPUT_STAGE_MAX_LEDS 21
+#endif
+
+/**
+ * @brief Converts LED colors into the bytes sent to the strip (GRB). Applies,
+ * in this order, gamma correction, white balance and global brightness in 8.8
+ * fixed point and spreads the remaining fraction across consecutive frames
+ * (temporal dithering). Uses lookup tables only, no per-pixel float math.
+ */
+class EFLedOutputStage {
+
+    protected:
+
+        bool gamma;                 //!< True, if gamma correction is applied
+        bool dithering;             //!< True, if temporal dithering is applied
+        CRGB white_balance;         //!< Per-channel correction factors (255 = unchanged)
+        uint8_t residue[EFLED_OUTPUT_STAGE_MAX_LEDS][3];  //!< Dithering error carried over to the next frame (GRB)
+
+    public:
+
+        /**
+         * @brief Constructs a new output stage. Gamma correction is disabled,
+         * white balance is neutral and dithering is enabled.
+         */
+        EFLedOutputStage();
+
+        /**
+         * @brief Enables or disables gamma correction (gamma 2.2)
+         *
+         * @param enabled True, to apply gamma correction
+         */
+        void setGammaCorrection(bool enabled);
+
+        /**
+         * @brief Determines if gamma correction is applied
+         *
+         * @return True, if gamma correction is enabled
+         */
+        bool isGammaCorrection() const;
+
+        /**
+         * @brief Enables or disables temporal dithering
+         *
+         * @param enabled True, to apply temporal dithering
+         */
+        void setDithering(bool enabled);
+
+        /**
+         * @brief Determines if temporal dithering is applied
+         *
+         * @return True, if temporal dithering is enabled
+         */
+        bool isDithering() const;
+
+        /**
+         * @brief Sets the per-channel white balance correction, e.g. one of
+         * FastLED's LEDColorCorrection values
+         *
+         * @param correction Correction factor for each channel (255 = unchanged)
+         */
+        void setWhiteBalance(const CRGB correction);
+
+        /**
+         * @brief Retrieves the per-channel white balance correction
+         *
+         * @return Correction factor for each channel (255 = unchanged)
+         */
+        CRGB getWhiteBalance() const;
+
+        /**
+         * @brief Clears the dithering error carried over between frames
+         */
+        void reset();
+
+        /**
+         * @brief Renders the given colors into wire bytes (GRB)
+         *
+         * @param leds Colors of all LEDs
+         * @param num Number of LEDs. At most EFLED_OUTPUT_STAGE_MAX_LEDS.
+         * @param brightness Global brightness (0-255)
+         * @param wire Buffer to render into. Must hold num * 3 bytes.
+         */
+        void render(const CRGB* leds, uint8_t num, uint8_t brightness, uint8_t* wire);
+};
+
+#endif /* EFLED_OUTPUT_STAGE_H_ */
@@ -0,0 +1,61 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "EFLedPalette.h"
+
+void EFLedValueRamp::build(uint8_t hue, uint8_t sat) {
+    this->hue = hue;
+    this->sat = sat;
+
+    for (uint16_t v = 0; v < 256; v++) {
+        this->colors[v] = CHSV(hue, sat, v);
+    }
+}
+
+EFLedPaletteClass::EFLedPaletteClass()
+: last_used()
+, use_counter(0)
+{
+}
+
+const EFLedValueRamp& EFLedPaletteClass::get(uint8_t hue, uint8_t sat) {
+    uint8_t lru = 0;
+
+    for (uint8_t i = 0; i < EFLED_PALETTE_SLOTS; i++) {
+        if (this->last_used[i] && this->ramps[i].hue == hue && this->ramps[i].sat == sat) {
+            this->last_used[i] = ++this->use_counter;
+            return this->ramps[i];
+        }
+        if (this->last_used[i] < this->last_used[lru]) {
+            lru = i;
+        }
+    }
+
+    this->ramps[lru].build(hue, sat);
+    this->last_used[lru] = ++this->use_counter;
+
+    return this->ramps[lru];
+}
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDPALETTE)
+EFLedPaletteClass EFLedPalette;
+#endif
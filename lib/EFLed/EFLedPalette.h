@@ -0,0 +1,106 @@
+#ifndef EFLED_PALETTE_H_
+#define EFLED_PALETTE_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include <FastLED.h>
+
+/**
+ * @brief Number of value ramps held at the same time
+ */
+#ifndef EFLED_PALETTE_SLOTS
+#define EFLED_PALETTE_SLOTS 4
+#endif
+
+/**
+ * @brief All 256 brightness values of a single hue and saturation, converted
+ * to RGB. ramp[v] equals CRGB(CHSV(hue, sat, v)).
+ */
+class EFLedValueRamp {
+
+    protected:
+
+        CRGB colors[256];  //!< Converted color for every value
+
+    public:
+
+        uint8_t hue;  //!< Hue of this ramp
+        uint8_t sat;  //!< Saturation of this ramp
+
+        /**
+         * @brief Converts all values of the given hue and saturation
+         *
+         * @param hue Hue to convert
+         * @param sat Saturation to convert
+         */
+        void build(uint8_t hue, uint8_t sat);
+
+        /**
+         * @brief Retrieves the color of the given brightness value
+         *
+         * @param value HSV value (brightness)
+         * @return Color equal to CHSV(hue, sat, value)
+         */
+        const CRGB& operator[](uint8_t value) const {
+            return this->colors[value];
+        }
+};
+
+/**
+ * @brief Provides precomputed value ramps for the constant hues a state uses
+ *
+ * States should request their ramps on entry or whenever their hue changes and
+ * use table lookups instead of HSV conversions per LED and tick. The least
+ * recently requested ramp is rebuilt if all slots are taken. A returned ramp
+ * thus stays valid until EFLED_PALETTE_SLOTS other ramps were requested.
+ */
+class EFLedPaletteClass {
+
+    protected:
+
+        EFLedValueRamp ramps[EFLED_PALETTE_SLOTS];   //!< Precomputed ramps
+        uint32_t last_used[EFLED_PALETTE_SLOTS];     //!< Value of use_counter at the last request, 0 if unused
+        uint32_t use_counter;                        //!< Monotonic counter for LRU bookkeeping
+
+    public:
+
+        EFLedPaletteClass();
+
+        /**
+         * @brief Retrieves the value ramp of the given hue and saturation.
+         * Builds it, if it is not available yet.
+         *
+         * @param hue Hue of the ramp
+         * @param sat Saturation of the ramp
+         * @return Ramp of all values
+         */
+        const EFLedValueRamp& get(uint8_t hue, uint8_t sat = 255);
+};
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFLEDPALETTE)
+extern EFLedPaletteClass EFLedPalette;
+#endif
+
+#endif /* EFLED_PALETTE_H_ */
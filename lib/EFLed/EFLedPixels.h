@@ -0,0 +1,123 @@
+#ifndef EFLED_PIXELS_H_
+#define EFLED_PIXELS_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include <FastLED.h>
+
+#include "EFLed.h"
+
+/**
+ * @brief Fixed-capacity list of colors that lives on the stack. Replaces
+ * std::vector<CRGB> within render code, which would allocate on every tick.
+ *
+ * @tparam N Maximum number of colors the list can hold
+ */
+template <uint8_t N = EFLED_TOTAL_NUM>
+class EFLedPixels {
+
+    protected:
+
+        CRGB pixels[N];  //!< Color storage
+        uint8_t len;     //!< Number of used entries
+
+    public:
+
+        /**
+         * @brief Constructs an empty list
+         */
+        EFLedPixels() : len(0) {}
+
+        /**
+         * @brief Constructs a list with num entries of the given color
+         *
+         * @param num Number of entries. Capped at the capacity N.
+         * @param color Color to fill the entries with
+         */
+        EFLedPixels(uint8_t num, const CRGB& color) : len(num < N ? num : N) {
+            for (uint8_t i = 0; i < this->len; i++) {
+                this->pixels[i] = color;
+            }
+        }
+
+        /**
+         * @brief Maximum number of colors the list can hold
+         */
+        static constexpr uint8_t capacity() {
+            return N;
+        }
+
+        /**
+         * @brief Number of colors currently in the list
+         */
+        uint8_t size() const {
+            return this->len;
+        }
+
+        /**
+         * @brief Determines if no more colors can be appended
+         */
+        bool full() const {
+            return this->len == N;
+        }
+
+        /**
+         * @brief Appends a color
+         *
+         * @return False, if the list was already full. The color was dropped.
+         */
+        bool push(const CRGB& color) {
+            if (this->full()) {
+                return false;
+            }
+            this->pixels[this->len++] = color;
+            return true;
+        }
+
+        /**
+         * @brief Appends num colors. Colors that exceed the capacity are dropped.
+         */
+        void append(const CRGB* colors, uint8_t num) {
+            for (uint8_t i = 0; i < num && this->push(colors[i]); i++);
+        }
+
+        /**
+         * @brief Removes all colors
+         */
+        void clear() {
+            this->len = 0;
+        }
+
+        CRGB* data() { return this->pixels; }
+        const CRGB* data() const { return this->pixels; }
+        CRGB* begin() { return this->pixels; }
+        const CRGB* begin() const { return this->pixels; }
+        CRGB* end() { return this->pixels + this->len; }
+        const CRGB* end() const { return this->pixels + this->len; }
+        CRGB& operator[](uint8_t idx) { return this->pixels[idx]; }
+        const CRGB& operator[](uint8_t idx) const { return this->pixels[idx]; }
+};
+
+#endif /* EFLED_PIXELS_H_ */
@@ -0,0 +1,100 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "EFLedGamma.h"
+#include "EFLedPowerModel.h"
+
+/**
+ * @brief Applies gamma correction and white balance to a single channel the
+ * same way EFLedOutputStage does, without dithering
+ */
+static inline uint8_t correctChannel(uint8_t value, bool gamma, uint8_t white_balance) {
+    const uint32_t linear = gamma ? EFLED_GAMMA22_LUT[value] : value << 8;
+    const uint32_t scale = white_balance ? white_balance + 1 : 0;
+    return (linear * scale) >> 16;
+}
+
+EFLedPowerModel::EFLedPowerModel(uint16_t budget_ma, uint16_t channel_ma, uint16_t idle_ua)
+: channel_ma(channel_ma)
+, idle_ua(idle_ua)
+, budget_ma(budget_ma)
+, gamma(false)
+, white_balance(CRGB(255, 255, 255))
+{
+}
+
+void EFLedPowerModel::setBudget(uint16_t budget_ma) {
+    this->budget_ma = budget_ma;
+}
+
+uint16_t EFLedPowerModel::getBudget() const {
+    return this->budget_ma;
+}
+
+void EFLedPowerModel::setGammaCorrection(bool enabled) {
+    this->gamma = enabled;
+}
+
+void EFLedPowerModel::setWhiteBalance(const CRGB correction) {
+    this->white_balance = correction;
+}
+
+uint32_t EFLedPowerModel::dutySum(const CRGB* leds, uint8_t num) const {
+    uint32_t sum = 0;
+    for (uint8_t i = 0; i < num; i++) {
+        sum += correctChannel(leds[i].r, this->gamma, this->white_balance.r);
+        sum += correctChannel(leds[i].g, this->gamma, this->white_balance.g);
+        sum += correctChannel(leds[i].b, this->gamma, this->white_balance.b);
+    }
+    return sum;
+}
+
+uint32_t EFLedPowerModel::estimateDynamicCurrent(uint32_t rgb_sum, uint8_t brightness) const {
+    // Duty cycle sum first, to keep the intermediate values within 32 bit
+    const uint32_t duty_sum = rgb_sum * brightness / 255;
+    return duty_sum * this->channel_ma * 1000 / 255;
+}
+
+uint32_t EFLedPowerModel::estimateCurrent(const CRGB* leds, uint8_t num, uint8_t brightness) const {
+    return this->estimateDynamicCurrent(this->dutySum(leds, num), brightness) + (uint32_t) num * this->idle_ua;
+}
+
+uint8_t EFLedPowerModel::limitBrightness(const CRGB* leds, uint8_t num, uint8_t brightness) const {
+    const uint32_t idle_ua = (uint32_t) num * this->idle_ua;
+    const uint32_t budget_ua = (uint32_t) this->budget_ma * 1000;
+    if (budget_ua <= idle_ua) {
+        return 0;
+    }
+
+    const uint32_t rgb_sum = this->dutySum(leds, num);
+    const uint32_t dynamic_ua = this->estimateDynamicCurrent(rgb_sum, brightness);
+    if (dynamic_ua + idle_ua <= budget_ua) {
+        return brightness;
+    }
+
+    // Current scales linearly with brightness. Rounding down keeps the result within budget.
+    uint8_t limited = (uint64_t) brightness * (budget_ua - idle_ua) / dynamic_ua;
+    while (limited > 0 && this->estimateDynamicCurrent(rgb_sum, limited) + idle_ua > budget_ua) {
+        limited--;
+    }
+    return limited;
+}
@@ -0,0 +1,152 @@
+#ifndef EFLED_POWER_MODEL_H_
+#define EFLED_POWER_MODEL_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include <FastLED.h>
+
+/**
+ * @brief Current drawn by a single WS2812B color channel at full duty cycle in mA
+ */
+#define EFLED_POWER_CHANNEL_MA_DEFAULT 12
+
+/**
+ * @brief Quiescent current drawn by a single WS2812B, even if it is dark, in uA
+ */
+#define EFLED_POWER_IDLE_UA_DEFAULT 1000
+
+/**
+ * @brief Default current budget for all LEDs in mA. Matches a full white frame
+ * on all 17 LEDs at a raw brightness of 45, which the 5V boost converter is
+ * known to handle on battery power.
+ */
+#define EFLED_POWER_BUDGET_MA_DEFAULT 125
+
+/**
+ * @brief Estimates the current drawn by the LEDs for a frame and limits the
+ * brightness of frames that would exceed a given current budget.
+ *
+ * The model is linear in the PWM duty cycle of each color channel, which is
+ * close enough for WS2812B LEDs. It holds no hardware state and can be used on
+ * any host.
+ */
+class EFLedPowerModel {
+
+    protected:
+
+        uint16_t channel_ma;  //!< Current per color channel at full duty cycle in mA
+        uint16_t idle_ua;     //!< Quiescent current per LED in uA
+        uint16_t budget_ma;   //!< Maximum current all LEDs are allowed to draw in mA
+        bool gamma;           //!< True, if the output applies gamma correction
+        CRGB white_balance;   //!< Per-channel white balance of the output (255 = unchanged)
+
+        /**
+         * @brief Calculates the sum over all color channels of all LEDs after
+         * gamma correction and white balance, i.e. the duty cycles sent to the
+         * LEDs at full brightness
+         *
+         * @param leds Colors of all LEDs
+         * @param num Number of LEDs
+         * @return Sum of the corrected channel values (0-255 each)
+         */
+        uint32_t dutySum(const CRGB* leds, uint8_t num) const;
+
+        /**
+         * @brief Estimates the current drawn by the color channels only
+         *
+         * @param rgb_sum Sum over all corrected color channels of all LEDs
+         * @param brightness Global brightness (0-255)
+         * @return Current in uA
+         */
+        uint32_t estimateDynamicCurrent(uint32_t rgb_sum, uint8_t brightness) const;
+
+    public:
+
+        /**
+         * @brief Constructs a new power model
+         *
+         * @param budget_ma Maximum current all LEDs are allowed to draw in mA
+         * @param channel_ma Current per color channel at full duty cycle in mA
+         * @param idle_ua Quiescent current per LED in uA
+         */
+        EFLedPowerModel(
+            uint16_t budget_ma = EFLED_POWER_BUDGET_MA_DEFAULT,
+            uint16_t channel_ma = EFLED_POWER_CHANNEL_MA_DEFAULT,
+            uint16_t idle_ua = EFLED_POWER_IDLE_UA_DEFAULT
+        );
+
+        /**
+         * @brief Sets the maximum current all LEDs are allowed to draw
+         *
+         * @param budget_ma Current budget in mA
+         */
+        void setBudget(uint16_t budget_ma);
+
+        /**
+         * @brief Retrieves the maximum current all LEDs are allowed to draw
+         *
+         * @return Current budget in mA
+         */
+        uint16_t getBudget() const;
+
+        /**
+         * @brief Accounts for gamma correction applied by the output stage.
+         * Should match EFLedOutputStage::setGammaCorrection().
+         *
+         * @param enabled True, if gamma correction is applied
+         */
+        void setGammaCorrection(bool enabled);
+
+        /**
+         * @brief Accounts for the white balance applied by the output stage.
+         * Should match EFLedOutputStage::setWhiteBalance().
+         *
+         * @param correction Correction factor for each channel (255 = unchanged)
+         */
+        void setWhiteBalance(const CRGB correction);
+
+        /**
+         * @brief Estimates the current drawn by the LEDs while displaying the given frame
+         *
+         * @param leds Colors of all LEDs
+         * @param num Number of LEDs
+         * @param brightness Global brightness (0-255) the frame is displayed at
+         * @return Estimated current in uA
+         */
+        uint32_t estimateCurrent(const CRGB* leds, uint8_t num, uint8_t brightness) const;
+
+        /**
+         * @brief Calculates the highest brightness, up to the given one, at which
+         * the given frame stays within the current budget
+         *
+         * @param leds Colors of all LEDs
+         * @param num Number of LEDs
+         * @param brightness Requested global brightness (0-255)
+         * @return Brightness to display the frame at
+         */
+        uint8_t limitBrightness(const CRGB* leds, uint8_t num, uint8_t brightness) const;
+};
+
+#endif /* EFLED_POWER_MODEL_H_ */
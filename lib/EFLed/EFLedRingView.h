@@ -0,0 +1,103 @@
+#ifndef EFLED_RINGVIEW_H_
+#define EFLED_RINGVIEW_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include <FastLED.h>
+
+/**
+ * @brief Number of fractional bits of an EFLedRingView position
+ */
+#define EFLED_RINGVIEW_FRAC_BITS 8
+
+/**
+ * @brief Non-owning view over a const color array that wraps around at its end.
+ * Used to render scrolling windows of a palette without copying or rotating it.
+ */
+class EFLedRingView {
+
+    protected:
+
+        const CRGB* colors;  //!< Viewed colors. Not owned by the view
+        uint8_t len;         //!< Number of viewed colors
+
+    public:
+
+        /**
+         * @brief Constructs a new view over the given colors
+         *
+         * @param colors Colors to view. Must outlive the view
+         * @param len Number of colors. Must not be 0
+         */
+        constexpr EFLedRingView(const CRGB* colors, uint8_t len) : colors(colors), len(len) {}
+
+        /**
+         * @brief Retrieves the color at the given index, wrapping around at the end
+         */
+        const CRGB& operator[](uint32_t idx) const {
+            return this->colors[idx % this->len];
+        }
+
+        /**
+         * @brief Builds a fixed-point position from a whole index and a blend fraction
+         *
+         * @param idx Index of the first color to show
+         * @param frac Blend amount towards the next color (0 = none, 255 = almost fully)
+         * @return Position to pass to render()
+         */
+        static constexpr uint32_t position(uint32_t idx, uint8_t frac) {
+            return (idx << EFLED_RINGVIEW_FRAC_BITS) | frac;
+        }
+
+        /**
+         * @brief Renders a window of the view in a single pass. Each output LED i
+         * shows entry (position + i), blended towards its successor by the fractional
+         * part of the position and faded afterwards.
+         *
+         * @param position Fixed-point start of the window, see position()
+         * @param out Destination to render into
+         * @param num Number of LEDs to render
+         * @param fade Amount to fade the output by (0 = none, 255 = black)
+         */
+        void render(uint32_t position, CRGB* out, uint8_t num, uint8_t fade = 0) const {
+            const uint8_t frac = position & ((1 << EFLED_RINGVIEW_FRAC_BITS) - 1);
+            uint8_t idx = (position >> EFLED_RINGVIEW_FRAC_BITS) % this->len;
+
+            for (uint8_t i = 0; i < num; i++) {
+                const uint8_t next = (idx + 1 == this->len) ? 0 : idx + 1;
+                CRGB color = this->colors[idx];
+                if (frac) {
+                    color = blend(color, this->colors[next], frac);
+                }
+                if (fade) {
+                    color.fadeLightBy(fade);
+                }
+                out[i] = color;
+                idx = next;
+            }
+        }
+};
+
+#endif /* EFLED_RINGVIEW_H_ */
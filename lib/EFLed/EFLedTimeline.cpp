@@ -0,0 +1,139 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include "EFLedTimeline.h"
+
+/**
+ * @brief Mixes the given value into a well distributed 32 bit hash
+ */
+static uint32_t hash32(uint32_t v) {
+    v ^= v >> 16;
+    v *= 0x7feb352dUL;
+    v ^= v >> 15;
+    v *= 0x846ca68bUL;
+    v ^= v >> 16;
+    return v;
+}
+
+const EFLedKeyframe& EFLedTimelinePlayer::keyframeAt(const EFLedTimeline& timeline, uint32_t t_ms) {
+    uint32_t total_ms = 0;
+    for (uint8_t i = 0; i < timeline.num_keyframes; i++) {
+        if (timeline.keyframes[i].duration_ms == 0) {
+            break;
+        }
+        total_ms += timeline.keyframes[i].duration_ms;
+    }
+
+    if (total_ms > 0) {
+        t_ms %= total_ms;
+    }
+
+    for (uint8_t i = 0; i < timeline.num_keyframes; i++) {
+        const uint16_t duration_ms = timeline.keyframes[i].duration_ms;
+        if (duration_ms == 0 || t_ms < duration_ms) {
+            return timeline.keyframes[i];
+        }
+        t_ms -= duration_ms;
+    }
+    return timeline.keyframes[timeline.num_keyframes - 1];
+}
+
+void EFLedTimelinePlayer::randomPalette(uint8_t len, uint32_t random_seed, CRGB* out) {
+    for (uint8_t i = 0; i < len; i++) {
+        out[i] = CHSV(hash32(random_seed + i) % 255, 255, 255);
+    }
+}
+
+void EFLedTimelinePlayer::render(const EFLedTimeline& timeline, uint32_t t_ms, uint32_t seed, CRGB out[EFLED_TOTAL_NUM]) {
+    if (timeline.num_keyframes == 0) {
+        return;
+    }
+
+    for (uint8_t n = 0; n < timeline.num_tracks; n++) {
+        const EFLedTrack& track = timeline.tracks[n];
+
+        // Tracks that hold their frame only sample the timeline at the start of each hold period
+        const uint32_t t = track.hold_ms ? t_ms - t_ms % track.hold_ms : t_ms;
+        const EFLedKeyframe& keyframe = keyframeAt(timeline, t);
+        if (keyframe.palette_len == 0) {
+            continue;
+        }
+
+        const uint32_t pos = track.step_ms ? t / track.step_ms : 0;
+        const uint8_t frac = (track.step_ms && (track.flags & EFLED_TRACK_BLEND))
+            ? (t % track.step_ms) * 255 / track.step_ms
+            : 0;
+
+        // Random palettes are generated onto the stack, fixed palettes are viewed in place
+        CRGB random_colors[EFLED_TIMELINE_MAX_RANDOM_COLORS];
+        const CRGB* colors = keyframe.palette;
+        uint8_t colors_len = keyframe.palette_len;
+        if (!colors) {
+            if (colors_len > EFLED_TIMELINE_MAX_RANDOM_COLORS) {
+                colors_len = EFLED_TIMELINE_MAX_RANDOM_COLORS;
+            }
+            randomPalette(colors_len, hash32(seed ^ (timeline.random_ms ? t / timeline.random_ms : 0)), random_colors);
+            colors = random_colors;
+        }
+
+        EFLedRingView(colors, colors_len).render(
+            EFLedRingView::position(pos % colors_len, frac),
+            &out[track.region.offset],
+            track.region.num,
+            track.fade
+        );
+    }
+}
+
+/**
+ * @brief Returns the shorter of both periods. 0 stands for a period that never ends.
+ */
+static uint16_t shorterPeriod(uint16_t a, uint16_t b) {
+    if (a == 0) {
+        return b;
+    }
+    if (b == 0) {
+        return a;
+    }
+    return a < b ? a : b;
+}
+
+uint16_t EFLedTimelinePlayer::getMaxSampleIntervalMs(const EFLedTimeline& timeline) {
+    uint16_t period_ms = 0;
+    for (uint8_t i = 0; i < timeline.num_tracks; i++) {
+        period_ms = shorterPeriod(period_ms, timeline.tracks[i].step_ms);
+        period_ms = shorterPeriod(period_ms, timeline.tracks[i].hold_ms);
+    }
+    for (uint8_t i = 0; i < timeline.num_keyframes; i++) {
+        if (timeline.num_keyframes > 1) {
+            period_ms = shorterPeriod(period_ms, timeline.keyframes[i].duration_ms);
+        }
+        if (!timeline.keyframes[i].palette) {
+            period_ms = shorterPeriod(period_ms, timeline.random_ms);
+        }
+    }
+
+    if (period_ms == 0) {
+        return UINT16_MAX;
+    }
+    return period_ms / EFLED_TIMELINE_SAMPLES_PER_STEP;
+}
@@ -0,0 +1,123 @@
+#ifndef EFLED_TIMELINE_H_
+#define EFLED_TIMELINE_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+#include "EFLed.h"
+#include "EFLedRingView.h"
+
+/**
+ * @brief Track flag: Blend smoothly between two rotation steps instead of jumping
+ */
+#define EFLED_TRACK_BLEND 0x01
+
+/**
+ * @brief Maximum number of colors of a random keyframe palette
+ */
+#define EFLED_TIMELINE_MAX_RANDOM_COLORS EFLED_TOTAL_NUM
+
+/**
+ * @brief Minimum number of times each step of a timeline is sampled, see
+ * EFLedTimelinePlayer::getMaxSampleIntervalMs()
+ */
+#define EFLED_TIMELINE_SAMPLES_PER_STEP 4
+
+/**
+ * @brief Writes a rotating window of the current keyframe palette onto a region
+ * of the LEDs
+ */
+struct EFLedTrack {
+    EFLedRegion region;  //!< LEDs this track writes to
+    uint16_t step_ms;    //!< Time per rotation step by one palette entry. 0 = no rotation
+    uint16_t hold_ms;    //!< Time the track holds a sampled frame. 0 = sample every frame
+    uint8_t fade;        //!< Amount to fade the track output by (0 = none, 255 = black)
+    uint8_t flags;       //!< Combination of EFLED_TRACK_* flags
+};
+
+/**
+ * @brief Palette shown by all tracks for a given duration
+ */
+struct EFLedKeyframe {
+    uint16_t duration_ms;  //!< Time this keyframe is shown. 0 = forever
+    const CRGB* palette;   //!< Colors to show or nullptr for random colors
+    uint8_t palette_len;   //!< Number of colors in the palette. Random palettes are capped at EFLED_TIMELINE_MAX_RANDOM_COLORS
+};
+
+/**
+ * @brief Animation described as const data. Keyframes are played in order and
+ * loop once the last one finished.
+ */
+struct EFLedTimeline {
+    const EFLedTrack* tracks;        //!< Tracks to render
+    uint8_t num_tracks;              //!< Number of tracks
+    const EFLedKeyframe* keyframes;  //!< Keyframes to play
+    uint8_t num_keyframes;           //!< Number of keyframes
+    uint16_t random_ms;              //!< Time after which random palettes change. 0 = never
+};
+
+/**
+ * @brief Interpreter for EFLedTimeline animations. Stateless: the frame is
+ * fully determined by the timeline, the elapsed time and the seed.
+ */
+class EFLedTimelinePlayer {
+
+    protected:
+
+        /**
+         * @brief Finds the keyframe active at the given time
+         */
+        static const EFLedKeyframe& keyframeAt(const EFLedTimeline& timeline, uint32_t t_ms);
+
+        /**
+         * @brief Generates the colors of a random palette. Colors are derived
+         * from the seed and the random period.
+         */
+        static void randomPalette(uint8_t len, uint32_t random_seed, CRGB* out);
+
+    public:
+
+        /**
+         * @brief Renders all tracks of the given timeline
+         *
+         * @param timeline Timeline to render
+         * @param t_ms Time since the animation started
+         * @param seed Seed for random palettes
+         * @param out LED data to render into. Only LEDs covered by a track are written.
+         */
+        static void render(const EFLedTimeline& timeline, uint32_t t_ms, uint32_t seed, CRGB out[EFLED_TOTAL_NUM]);
+
+        /**
+         * @brief Determines the longest interval the timeline may be rendered
+         * at without delaying visible changes noticeably. The shortest rotation
+         * step, hold time, keyframe duration or random period is sampled at
+         * least EFLED_TIMELINE_SAMPLES_PER_STEP times.
+         *
+         * @param timeline Timeline to check
+         * @return Interval in milliseconds or UINT16_MAX, if the timeline never changes
+         */
+        static uint16_t getMaxSampleIntervalMs(const EFLedTimeline& timeline);
+};
+
+#endif /* EFLED_TIMELINE_H_ */
@@ -0,0 +1,250 @@
+#ifndef EFMATH_H_
+#define EFMATH_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <stdint.h>
+
+/**
+ * @brief Fixed-point math for animations. Avoids float math in per-frame code,
+ * since the CPU runs at only 80 MHz.
+ *
+ * Conventions:
+ * - q8_8_t: Signed 8.8 fixed point (256 = 1.0)
+ * - q16_16_t: Signed 16.16 fixed point (65536 = 1.0)
+ * - Angles: uint16_t, 65536 = full turn (32768 = pi)
+ * - Fractions: uint8_t, 0 = 0.0, 255 = 1.0
+ */
+namespace EFMath {
+
+    typedef int16_t q8_8_t;
+    typedef int32_t q16_16_t;
+
+    constexpr q8_8_t Q8_8_ONE = 1 << 8;
+    constexpr q16_16_t Q16_16_ONE = 1 << 16;
+
+    constexpr uint16_t ANGLE_HALF_TURN = 32768;
+    constexpr uint16_t ANGLE_QUARTER_TURN = 16384;
+
+    /**
+     * @brief Converts an integer into Q8.8
+     */
+    constexpr q8_8_t toQ8_8(int16_t v) {
+        return v * Q8_8_ONE;
+    }
+
+    /**
+     * @brief Converts an integer into Q16.16
+     */
+    constexpr q16_16_t toQ16_16(int32_t v) {
+        return v * Q16_16_ONE;
+    }
+
+    /**
+     * @brief Multiplies two Q8.8 values
+     */
+    constexpr q8_8_t mulQ8_8(q8_8_t a, q8_8_t b) {
+        return ((int32_t) a * b) >> 8;
+    }
+
+    /**
+     * @brief Multiplies two Q16.16 values
+     */
+    constexpr q16_16_t mulQ16_16(q16_16_t a, q16_16_t b) {
+        return ((int64_t) a * b) >> 16;
+    }
+
+    /**
+     * @brief Divides two Q16.16 values. b must not be 0.
+     */
+    constexpr q16_16_t divQ16_16(q16_16_t a, q16_16_t b) {
+        return ((int64_t) a << 16) / b;
+    }
+
+    namespace detail {
+
+        /**
+         * @brief Taylor series of sin(x) for 0 <= x <= pi/2. Only used at compile time.
+         */
+        constexpr double sin(double x) {
+            double sum = 0.0;
+            double term = x;
+            for (uint8_t n = 1; n < 20; n += 2) {
+                sum += term;
+                term *= -x * x / ((n + 1) * (n + 2));
+            }
+            return sum;
+        }
+
+        struct SineTable {
+            uint16_t data[65];
+        };
+
+        constexpr SineTable sineTable() {
+            SineTable table = {};
+            for (uint8_t i = 0; i <= 64; i++) {
+                const double v = sin(i * 3.14159265358979323846 / 128) * 32767 + 0.5;
+                table.data[i] = (uint16_t) v;
+            }
+            return table;
+        }
+
+    }
+
+    /**
+     * @brief First quarter of a sine wave in 64 steps, scaled to 0 - 32767
+     */
+    inline constexpr detail::SineTable SINE_QUARTER_LUT = detail::sineTable();
+
+    /**
+     * @brief Calculates the sine of the given angle using a lookup table with
+     * linear interpolation
+     *
+     * @param angle Angle, 65536 = full turn
+     * @return Sine value scaled to -32767 - 32767 (Q1.15)
+     */
+    constexpr int16_t sin(uint16_t angle) {
+        uint16_t quarter_angle = angle & (ANGLE_QUARTER_TURN - 1);
+        if (angle & ANGLE_QUARTER_TURN) {
+            quarter_angle = ANGLE_QUARTER_TURN - quarter_angle;
+        }
+
+        // 64 table steps per quarter turn, 256 angle units per step
+        const uint8_t idx = quarter_angle >> 8;
+        const uint8_t frac = quarter_angle & 0xFF;
+        uint16_t value = SINE_QUARTER_LUT.data[idx];
+        if (frac) {
+            value += ((SINE_QUARTER_LUT.data[idx + 1] - value) * frac) >> 8;
+        }
+
+        return (angle & ANGLE_HALF_TURN) ? -value : value;
+    }
+
+    /**
+     * @brief Calculates the cosine of the given angle. See sin().
+     */
+    constexpr int16_t cos(uint16_t angle) {
+        return sin(angle + ANGLE_QUARTER_TURN);
+    }
+
+    /**
+     * @brief Calculates the integer square root, rounded down
+     */
+    constexpr uint16_t isqrt(uint32_t v) {
+        uint32_t result = 0;
+        uint32_t bit = 1UL << 30;
+        while (bit > v) {
+            bit >>= 2;
+        }
+        while (bit) {
+            if (v >= result + bit) {
+                v -= result + bit;
+                result = (result >> 1) + bit;
+            } else {
+                result >>= 1;
+            }
+            bit >>= 2;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Linearly interpolates between two 8 bit values
+     *
+     * @param a Value at frac = 0
+     * @param b Value at frac = 255
+     * @param frac Position between a and b
+     */
+    constexpr uint8_t lerp8(uint8_t a, uint8_t b, uint8_t frac) {
+        return a + (((int16_t) b - a) * frac + (b > a ? 127 : -127)) / 255;
+    }
+
+    /**
+     * @brief Linearly interpolates between two Q16.16 values
+     *
+     * @param a Value at frac = 0
+     * @param b Value at frac = Q16_16_ONE
+     * @param frac Position between a and b, 0 - Q16_16_ONE
+     */
+    constexpr q16_16_t lerpQ16_16(q16_16_t a, q16_16_t b, q16_16_t frac) {
+        return a + mulQ16_16(b - a, frac);
+    }
+
+    /**
+     * @brief Quadratic ease-in
+     */
+    constexpr uint8_t easeInQuad(uint8_t t) {
+        return ((uint16_t) t * t + 255) >> 8;
+    }
+
+    /**
+     * @brief Quadratic ease-out
+     */
+    constexpr uint8_t easeOutQuad(uint8_t t) {
+        return 255 - easeInQuad(255 - t);
+    }
+
+    /**
+     * @brief Quadratic ease-in-out
+     */
+    constexpr uint8_t easeInOutQuad(uint8_t t) {
+        return t < 128 ? easeInQuad(t << 1) >> 1 : 128 + (easeOutQuad((t - 128) << 1) >> 1);
+    }
+
+    /**
+     * @brief Cubic ease-in
+     */
+    constexpr uint8_t easeInCubic(uint8_t t) {
+        return ((uint32_t) t * t * t + 65024) / 65025;
+    }
+
+    /**
+     * @brief Cubic ease-out
+     */
+    constexpr uint8_t easeOutCubic(uint8_t t) {
+        return 255 - easeInCubic(255 - t);
+    }
+
+    /**
+     * @brief Calculates a single positive half wave of a sine between start and
+     * end. Values outside of [start, end] are 0.
+     *
+     * @param x Position to evaluate
+     * @param start Start of the half wave
+     * @param end End of the half wave. Must be greater than start.
+     * @param amplitude Peak value of the wave
+     * @return Wave value between 0 and amplitude
+     */
+    constexpr uint8_t halfWave(int32_t x, int32_t start, int32_t end, uint8_t amplitude) {
+        if (x < start || x > end || end <= start) {
+            return 0;
+        }
+
+        const uint16_t angle = (uint32_t) (x - start) * ANGLE_HALF_TURN / (end - start);
+        const int16_t s = sin(angle);
+        return s <= 0 ? 0 : ((int32_t) s * amplitude + 16383) >> 15;
+    }
+
+}
+
+#endif /* EFMATH_H_ */
@@ -0,0 +1,251 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <Arduino.h>
+
+#include <EFLogging.h>
+
+#include "EFScheduler.h"
+
+/**
+ * @brief Marks a due job that already ran during the current run() call and
+ * is put back into the heap afterwards
+ */
+#define EFSCHEDULER_DEFERRED 0xFE
+
+EFSchedulerClass::EFSchedulerClass(EFSchedulerClock clock)
+: clock(clock)
+, jobs()
+, num_jobs(0)
+, heap()
+, heap_num(0)
+{
+    for (uint8_t i = 0; i < EFSCHEDULER_MAX_JOBS; i++) {
+        this->heap_pos[i] = EFSCHEDULER_INVALID_JOB;
+    }
+}
+
+bool EFSchedulerClass::isBefore(uint32_t a, uint32_t b) {
+    return (int32_t) (a - b) < 0;
+}
+
+void EFSchedulerClass::heapSwap(uint8_t a, uint8_t b) {
+    const EFSchedulerJobId tmp = this->heap[a];
+    this->heap[a] = this->heap[b];
+    this->heap[b] = tmp;
+    this->heap_pos[this->heap[a]] = a;
+    this->heap_pos[this->heap[b]] = b;
+}
+
+void EFSchedulerClass::heapSiftUp(uint8_t pos) {
+    while (pos > 0) {
+        const uint8_t parent = (pos - 1) / 2;
+        if (!isBefore(this->jobs[this->heap[pos]].deadline_ms, this->jobs[this->heap[parent]].deadline_ms)) {
+            return;
+        }
+        this->heapSwap(pos, parent);
+        pos = parent;
+    }
+}
+
+void EFSchedulerClass::heapSiftDown(uint8_t pos) {
+    while (true) {
+        uint8_t smallest = pos;
+        for (uint8_t child = 2 * pos + 1; child <= 2 * pos + 2 && child < this->heap_num; child++) {
+            if (isBefore(this->jobs[this->heap[child]].deadline_ms, this->jobs[this->heap[smallest]].deadline_ms)) {
+                smallest = child;
+            }
+        }
+        if (smallest == pos) {
+            return;
+        }
+        this->heapSwap(pos, smallest);
+        pos = smallest;
+    }
+}
+
+void EFSchedulerClass::heapPush(EFSchedulerJobId id) {
+    const uint8_t pos = this->heap_num++;
+    this->heap[pos] = id;
+    this->heap_pos[id] = pos;
+    this->heapSiftUp(pos);
+}
+
+void EFSchedulerClass::heapRemove(EFSchedulerJobId id) {
+    const uint8_t pos = this->heap_pos[id];
+    this->heap_pos[id] = EFSCHEDULER_INVALID_JOB;
+    if (pos == EFSCHEDULER_INVALID_JOB || pos == EFSCHEDULER_DEFERRED) {
+        return;
+    }
+
+    // Replace by the last entry and restore order in both directions
+    this->heap_num--;
+    if (pos == this->heap_num) {
+        return;
+    }
+    const EFSchedulerJobId moved = this->heap[this->heap_num];
+    this->heap[pos] = moved;
+    this->heap_pos[moved] = pos;
+    this->heapSiftUp(pos);
+    this->heapSiftDown(this->heap_pos[moved]);
+}
+
+void EFSchedulerClass::arm(EFSchedulerJobId id, uint32_t deadline_ms, uint32_t period_ms) {
+    if (id >= this->num_jobs) {
+        return;
+    }
+
+    this->heapRemove(id);
+    this->jobs[id].deadline_ms = deadline_ms;
+    this->jobs[id].period_ms = period_ms;
+    this->heapPush(id);
+}
+
+EFSchedulerJobId EFSchedulerClass::add(const char* name, EFSchedulerCallback callback, void* ctx) {
+    if (this->num_jobs >= EFSCHEDULER_MAX_JOBS || callback == nullptr) {
+        LOGF_ERROR("(EFScheduler) Failed to add job: %s\r\n", name);
+        return EFSCHEDULER_INVALID_JOB;
+    }
+
+    const EFSchedulerJobId id = this->num_jobs++;
+    this->jobs[id] = {name, callback, ctx, 0, 0, 0, 0, 0, 0};
+    return id;
+}
+
+void EFSchedulerClass::startOnce(EFSchedulerJobId id, uint32_t delay_ms) {
+    this->arm(id, this->clock() + delay_ms, 0);
+}
+
+void EFSchedulerClass::startPeriodic(EFSchedulerJobId id, uint32_t period_ms, uint32_t delay_ms) {
+    this->arm(id, this->clock() + delay_ms, period_ms);
+}
+
+void EFSchedulerClass::stop(EFSchedulerJobId id) {
+    if (id >= this->num_jobs) {
+        return;
+    }
+    this->heapRemove(id);
+}
+
+bool EFSchedulerClass::isPending(EFSchedulerJobId id) const {
+    return id < this->num_jobs && this->heap_pos[id] != EFSCHEDULER_INVALID_JOB;
+}
+
+uint32_t EFSchedulerClass::run() {
+    const uint32_t now = this->clock();
+    EFSchedulerJobId deferred[EFSCHEDULER_MAX_JOBS];
+    uint8_t num_deferred = 0;
+    uint32_t ran = 0;
+
+    while (this->heap_num > 0) {
+        const EFSchedulerJobId id = this->heap[0];
+        EFSchedulerJob& job = this->jobs[id];
+        if (isBefore(now, job.deadline_ms)) {
+            break;
+        }
+
+        // Jobs that became due again by their own callback wait for the next call
+        this->heapRemove(id);
+        if (ran & (1UL << id)) {
+            this->heap_pos[id] = EFSCHEDULER_DEFERRED;
+            deferred[num_deferred++] = id;
+            continue;
+        }
+        ran |= 1UL << id;
+
+        // Jitter statistics
+        const uint32_t late_ms = now - job.deadline_ms;
+        job.runs++;
+        job.late_sum_ms += late_ms;
+        if (late_ms > job.late_max_ms) {
+            job.late_max_ms = late_ms;
+        }
+
+        // Re-arm periodic jobs relative to their deadline to stay phase-locked
+        if (job.period_ms > 0) {
+            uint32_t next_ms = job.deadline_ms + job.period_ms;
+            if (!isBefore(now, next_ms)) {
+                const uint32_t missed = (now - next_ms) / job.period_ms + 1;
+                job.missed += missed;
+                next_ms += missed * job.period_ms;
+            }
+            job.deadline_ms = next_ms;
+            this->heapPush(id);
+        }
+
+        job.callback(job.ctx);
+    }
+
+    // Re-insert deferred jobs, unless they were stopped or re-armed meanwhile
+    for (uint8_t i = 0; i < num_deferred; i++) {
+        if (this->heap_pos[deferred[i]] == EFSCHEDULER_DEFERRED) {
+            this->heapPush(deferred[i]);
+        }
+    }
+
+    return this->getMsUntilNextDeadline();
+}
+
+uint32_t EFSchedulerClass::getMsUntilNextDeadline() const {
+    if (this->heap_num == 0) {
+        return EFSCHEDULER_NO_DEADLINE;
+    }
+
+    const uint32_t now = this->clock();
+    const uint32_t deadline_ms = this->jobs[this->heap[0]].deadline_ms;
+    return isBefore(now, deadline_ms) ? deadline_ms - now : 0;
+}
+
+uint8_t EFSchedulerClass::getJobCount() const {
+    return this->num_jobs;
+}
+
+const EFSchedulerJob& EFSchedulerClass::getJob(EFSchedulerJobId id) const {
+    return this->jobs[id < this->num_jobs ? id : 0];
+}
+
+void EFSchedulerClass::resetStatistics() {
+    for (uint8_t i = 0; i < this->num_jobs; i++) {
+        this->jobs[i].runs = 0;
+        this->jobs[i].missed = 0;
+        this->jobs[i].late_sum_ms = 0;
+        this->jobs[i].late_max_ms = 0;
+    }
+}
+
+void EFSchedulerClass::logSummary() const {
+    for (uint8_t i = 0; i < this->num_jobs; i++) {
+        const EFSchedulerJob& job = this->jobs[i];
+        LOGF_INFO(
+            "(EFScheduler) %s: %lu runs, %lu missed, jitter avg/max = %lu/%lu ms\r\n",
+            job.name,
+            (unsigned long) job.runs,
+            (unsigned long) job.missed,
+            (unsigned long) (job.runs > 0 ? job.late_sum_ms / job.runs : 0),
+            (unsigned long) job.late_max_ms
+        );
+    }
+}
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFSCHEDULER)
+EFSchedulerClass EFScheduler;
+#endif
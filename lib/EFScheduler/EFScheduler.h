@@ -0,0 +1,241 @@
+#ifndef EFSCHEDULER_H_
+#define EFSCHEDULER_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <Arduino.h>
+
+/**
+ * @brief Maximum number of jobs a scheduler can manage
+ */
+#define EFSCHEDULER_MAX_JOBS 16
+
+/**
+ * @brief Job id returned if no job could be added
+ */
+#define EFSCHEDULER_INVALID_JOB 0xFF
+
+/**
+ * @brief Returned by getMsUntilNextDeadline() if no job is pending
+ */
+#define EFSCHEDULER_NO_DEADLINE UINT32_MAX
+
+/**
+ * @brief Identifies a job of an EFSchedulerClass
+ */
+typedef uint8_t EFSchedulerJobId;
+
+/**
+ * @brief Function executed by a job
+ *
+ * @param ctx Context pointer given to add()
+ */
+typedef void (*EFSchedulerCallback)(void* ctx);
+
+/**
+ * @brief Clock a scheduler runs on, returning milliseconds
+ */
+typedef unsigned long (*EFSchedulerClock)();
+
+/**
+ * @brief A job managed by EFSchedulerClass
+ */
+struct EFSchedulerJob {
+    const char* name;              //!< Name used for reporting
+    EFSchedulerCallback callback;  //!< Function to execute
+    void* ctx;                     //!< Context pointer passed to callback
+    uint32_t deadline_ms;          //!< Time the job is due next
+    uint32_t period_ms;            //!< Period of the job, 0 for one-shot jobs
+    uint32_t runs;                 //!< Number of executions since the statistics were reset
+    uint32_t missed;               //!< Number of periods skipped entirely, because the job ran too late
+    uint32_t late_sum_ms;          //!< Sum of the delays between deadline and execution
+    uint32_t late_max_ms;          //!< Largest delay between deadline and execution
+};
+
+/**
+ * @brief Deadline scheduler for one-shot and periodic jobs of the main loop
+ *
+ * Pending jobs are kept in a fixed-size binary min-heap ordered by deadline,
+ * so neither scheduling nor running jobs allocates. Periodic jobs are
+ * phase-locked: the next deadline is derived from the previous deadline and
+ * not from the time the job actually ran, so execution delays do not
+ * accumulate. If a job falls behind by more than a period, the missed periods
+ * are skipped and counted.
+ *
+ * For each job, the delay between its deadline and its execution is tracked
+ * as jitter statistic.
+ */
+class EFSchedulerClass {
+
+    protected:
+
+        const EFSchedulerClock clock;                 //!< Time source
+
+        EFSchedulerJob jobs[EFSCHEDULER_MAX_JOBS];    //!< All added jobs, indexed by EFSchedulerJobId
+        uint8_t num_jobs;                             //!< Number of added jobs
+
+        EFSchedulerJobId heap[EFSCHEDULER_MAX_JOBS];  //!< Pending jobs, ordered by deadline
+        uint8_t heap_pos[EFSCHEDULER_MAX_JOBS];       //!< Position of each job inside heap or EFSCHEDULER_INVALID_JOB if not pending
+        uint8_t heap_num;                             //!< Number of pending jobs
+
+        /**
+         * @brief Determines if deadline a lies before deadline b. Handles
+         * overflows of the clock.
+         */
+        static bool isBefore(uint32_t a, uint32_t b);
+
+        /**
+         * @brief Inserts a job into the heap
+         */
+        void heapPush(EFSchedulerJobId id);
+
+        /**
+         * @brief Removes a job from the heap, if it is pending
+         */
+        void heapRemove(EFSchedulerJobId id);
+
+        /**
+         * @brief Moves the entry at pos towards the root until the heap is ordered
+         */
+        void heapSiftUp(uint8_t pos);
+
+        /**
+         * @brief Moves the entry at pos towards the leaves until the heap is ordered
+         */
+        void heapSiftDown(uint8_t pos);
+
+        /**
+         * @brief Swaps two heap entries
+         */
+        void heapSwap(uint8_t a, uint8_t b);
+
+        /**
+         * @brief (Re-)arms a job
+         */
+        void arm(EFSchedulerJobId id, uint32_t deadline_ms, uint32_t period_ms);
+
+    public:
+
+        /**
+         * @brief Constructs a new scheduler
+         *
+         * @param clock Time source in milliseconds. Allows to use a fake clock
+         * on the host.
+         */
+        explicit EFSchedulerClass(EFSchedulerClock clock = millis);
+
+        /**
+         * @brief Adds a new job. The job is not run until it is started via
+         * startOnce() or startPeriodic().
+         *
+         * @param name Name used for reporting. Must outlive the scheduler.
+         * @param callback Function to execute
+         * @param ctx Context pointer passed to callback
+         * @return Id of the new job or EFSCHEDULER_INVALID_JOB, if all slots are in use
+         */
+        EFSchedulerJobId add(const char* name, EFSchedulerCallback callback, void* ctx = nullptr);
+
+        /**
+         * @brief Runs the job once after the given delay. Replaces any pending
+         * deadline of the job.
+         *
+         * @param id Job to start
+         * @param delay_ms Milliseconds from now. 0 runs the job during the next run().
+         */
+        void startOnce(EFSchedulerJobId id, uint32_t delay_ms = 0);
+
+        /**
+         * @brief Runs the job periodically, starting after the given delay.
+         * Replaces any pending deadline of the job.
+         *
+         * @param id Job to start
+         * @param period_ms Interval between deadlines in milliseconds
+         * @param delay_ms Milliseconds from now until the first execution
+         */
+        void startPeriodic(EFSchedulerJobId id, uint32_t period_ms, uint32_t delay_ms = 0);
+
+        /**
+         * @brief Cancels any pending execution of the job
+         *
+         * @param id Job to stop
+         */
+        void stop(EFSchedulerJobId id);
+
+        /**
+         * @brief Determines if the job is waiting for its deadline
+         *
+         * @param id Job to check
+         * @return True, if the job will run in the future
+         */
+        bool isPending(EFSchedulerJobId id) const;
+
+        /**
+         * @brief Executes all jobs that are due, earliest deadline first.
+         * Jobs may add, start or stop jobs, including themselves. Jobs that
+         * become due by this are executed as well, but every job runs at most
+         * once per call.
+         *
+         * @return Milliseconds until the next deadline, see getMsUntilNextDeadline()
+         */
+        uint32_t run();
+
+        /**
+         * @brief Retrieves the time until the earliest pending deadline. Allows
+         * the caller to sleep in between.
+         *
+         * @return Milliseconds until the next job is due, 0 if a job is
+         * overdue or EFSCHEDULER_NO_DEADLINE if no job is pending
+         */
+        uint32_t getMsUntilNextDeadline() const;
+
+        /**
+         * @brief Retrieves the number of added jobs
+         *
+         * @return Number of jobs
+         */
+        uint8_t getJobCount() const;
+
+        /**
+         * @brief Retrieves a job including its statistics
+         *
+         * @param id Job to retrieve
+         * @return The job
+         */
+        const EFSchedulerJob& getJob(EFSchedulerJobId id) const;
+
+        /**
+         * @brief Resets the jitter statistics of all jobs
+         */
+        void resetStatistics();
+
+        /**
+         * @brief Logs runs and average / maximum jitter of all jobs
+         */
+        void logSummary() const;
+};
+
+#if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_EFSCHEDULER)
+extern EFSchedulerClass EFScheduler;
+#endif
+
+#endif /* EFSCHEDULER_H_ */
@@ -0,0 +1,641 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+// Generated by native/bench/gen_animation_fixture.py with tools/efanim.py. Do not edit.
+
+#ifndef NATIVE_BENCH_ANIMATION_FIXTURE_H_
+#define NATIVE_BENCH_ANIMATION_FIXTURE_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Animation partition image written by tools/efanim.py
+ */
+alignas(4) static const uint8_t ANIMATION_FIXTURE_IMAGE[] = {
+    0x45, 0x46, 0x41, 0x4e, 0x01, 0x11, 0x32, 0x00, 0x28, 0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00,
+    0x53, 0x70, 0x61, 0x72, 0x6b, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x0d, 0x80, 0x5b, 0x73, 0x43, 0x01, 0x01, 0x80, 0x0e, 0xd0, 0x7a, 0x02, 0x80, 0x53, 0x43,
+    0x60, 0x04, 0x80, 0x6b, 0x6d, 0x49, 0x03, 0x10, 0x03, 0x80, 0x8a, 0x77, 0xe5, 0x02, 0x80, 0x66,
+    0x06, 0x91, 0x06, 0x80, 0xa1, 0x42, 0x5a, 0x10, 0x00, 0x80, 0x67, 0xbc, 0x23, 0x02, 0x80, 0xdb,
+    0xf9, 0xbf, 0x09, 0x80, 0xc1, 0x83, 0xc5, 0x05, 0x80, 0x75, 0x58, 0x9e, 0x09, 0x04, 0x81, 0x69,
+    0xe5, 0xda, 0xd7, 0x0f, 0x71, 0x04, 0x80, 0x1f, 0xa5, 0xb7, 0x01, 0x81, 0x36, 0xff, 0x4c, 0xc1,
+    0x83, 0xc5, 0x80, 0x76, 0x78, 0x11, 0x0c, 0x80, 0xde, 0xd0, 0x81, 0x01, 0x0a, 0x80, 0x01, 0xe9,
+    0xbb, 0x04, 0x10, 0x03, 0x80, 0xce, 0x64, 0x34, 0x0b, 0x10, 0x05, 0x80, 0xe4, 0x24, 0x4e, 0x08,
+    0x80, 0x57, 0x2c, 0xe6, 0x0b, 0x80, 0xf6, 0xc8, 0xcd, 0x02, 0x80, 0x23, 0xa8, 0x7b, 0x02, 0x80,
+    0xbf, 0x2d, 0xaa, 0x09, 0x80, 0xcb, 0x94, 0xc8, 0x01, 0x00, 0x80, 0x2e, 0xcc, 0x7c, 0x0e, 0x80,
+    0x9b, 0xf6, 0x67, 0x0f, 0x80, 0xf3, 0x0f, 0xed, 0x0f, 0x00, 0x80, 0x24, 0x3e, 0xd1, 0x0e, 0x10,
+    0x0a, 0x81, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x03, 0x01, 0x80, 0x3b, 0x3d, 0xbe, 0x04, 0x80,
+    0x20, 0x67, 0x51, 0x06, 0x80, 0xe7, 0xce, 0xfe, 0x07, 0x80, 0x71, 0xb7, 0xc6, 0x07, 0x0e, 0x81,
+    0xc6, 0x13, 0x8c, 0xe7, 0xce, 0xfe, 0x06, 0x83, 0xa2, 0x11, 0xa7, 0x71, 0xb7, 0xc6, 0x72, 0xbe,
+    0xa1, 0xa3, 0xc7, 0x54, 0x01, 0x80, 0x8d, 0xbe, 0x4c, 0x02, 0x80, 0x52, 0xbe, 0xfd, 0x06, 0x81,
+    0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0x05, 0x80, 0xc3, 0x02, 0x11, 0x10, 0x01, 0x80, 0x2a, 0xf4,
+    0x52, 0x0a, 0x82, 0x7b, 0xe9, 0x5c, 0xc6, 0x13, 0x8c, 0xe7, 0x96, 0xa9, 0x02, 0x80, 0xc2, 0x8e,
+    0x6e, 0x0a, 0x81, 0xc1, 0x27, 0xd9, 0xe7, 0x96, 0xa9, 0x10, 0x04, 0x82, 0xe0, 0x65, 0x67, 0xe4,
+    0x24, 0x4e, 0x8b, 0x81, 0x44, 0x07, 0x80, 0x1e, 0x9b, 0x71, 0x0c, 0x80, 0x78, 0xf8, 0xc6, 0x02,
+    0x0a, 0x81, 0x78, 0x23, 0x97, 0xd7, 0x05, 0x81, 0x03, 0x10, 0x00, 0x80, 0x9b, 0xf1, 0x75, 0x01,
+    0x80, 0x7f, 0x0e, 0x49, 0x01, 0x80, 0x8e, 0x5f, 0x1e, 0x08, 0x02, 0x80, 0xa7, 0xcc, 0x81, 0x0c,
+    0x10, 0x00, 0x80, 0xac, 0xd5, 0x04, 0x0c, 0x81, 0xce, 0x8f, 0xb6, 0x1e, 0x9b, 0x71, 0xff, 0xff,
+    0x45, 0x46, 0x41, 0x4e, 0x01, 0x11, 0x14, 0x00, 0x44, 0x00, 0x00, 0x00, 0xa1, 0x01, 0x00, 0x00,
+    0x57, 0x69, 0x70, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0xff, 0x00, 0x00, 0x0f, 0x00, 0x80, 0xff, 0x00, 0x00, 0x0e, 0x01, 0x80, 0xff, 0x00, 0x00,
+    0x0d, 0x02, 0x80, 0xff, 0x00, 0x00, 0x0c, 0x03, 0x80, 0xff, 0x00, 0x00, 0x0b, 0x04, 0x80, 0xff,
+    0x00, 0x00, 0x0a, 0x05, 0x80, 0xff, 0x00, 0x00, 0x09, 0x06, 0x80, 0xff, 0x00, 0x00, 0x08, 0x07,
+    0x80, 0xff, 0x00, 0x00, 0x07, 0x08, 0x80, 0xff, 0x00, 0x00, 0x06, 0x09, 0x80, 0xff, 0x00, 0x00,
+    0x05, 0x0a, 0x80, 0xff, 0x00, 0x00, 0x04, 0x0b, 0x80, 0xff, 0x00, 0x00, 0x03, 0x0c, 0x80, 0xff,
+    0x00, 0x00, 0x02, 0x0d, 0x80, 0xff, 0x00, 0x00, 0x01, 0x0e, 0x81, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x0f, 0x80, 0xff, 0x00, 0x00, 0x80, 0x00, 0xff, 0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x00, 0xff, 0x00, 0x0e, 0x01, 0x80, 0x00, 0xff, 0x00, 0x0d, 0x02, 0x80, 0x00, 0xff, 0x00, 0x0c,
+    0x03, 0x80, 0x00, 0xff, 0x00, 0x0b, 0x04, 0x80, 0x00, 0xff, 0x00, 0x0a, 0x05, 0x80, 0x00, 0xff,
+    0x00, 0x09, 0x06, 0x80, 0x00, 0xff, 0x00, 0x08, 0x07, 0x80, 0x00, 0xff, 0x00, 0x07, 0x08, 0x80,
+    0x00, 0xff, 0x00, 0x06, 0x09, 0x80, 0x00, 0xff, 0x00, 0x05, 0x0a, 0x80, 0x00, 0xff, 0x00, 0x04,
+    0x0b, 0x80, 0x00, 0xff, 0x00, 0x03, 0x0c, 0x80, 0x00, 0xff, 0x00, 0x02, 0x0d, 0x80, 0x00, 0xff,
+    0x00, 0x01, 0x0e, 0x81, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0xff, 0x00, 0x80,
+    0x00, 0x00, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0xff, 0x0e, 0x01, 0x80, 0x00,
+    0x00, 0xff, 0x0d, 0x02, 0x80, 0x00, 0x00, 0xff, 0x0c, 0x03, 0x80, 0x00, 0x00, 0xff, 0x0b, 0x04,
+    0x80, 0x00, 0x00, 0xff, 0x0a, 0x05, 0x80, 0x00, 0x00, 0xff, 0x09, 0x06, 0x80, 0x00, 0x00, 0xff,
+    0x08, 0x07, 0x80, 0x00, 0x00, 0xff, 0x07, 0x08, 0x80, 0x00, 0x00, 0xff, 0x06, 0x09, 0x80, 0x00,
+    0x00, 0xff, 0x05, 0x0a, 0x80, 0x00, 0x00, 0xff, 0x04, 0x0b, 0x80, 0x00, 0x00, 0xff, 0x03, 0x0c,
+    0x80, 0x00, 0x00, 0xff, 0x02, 0x0d, 0x80, 0x00, 0x00, 0xff, 0x01, 0x0e, 0x81, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0xff, 0x80, 0xff, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0xff, 0xff, 0xff, 0x0e, 0x01, 0x80, 0xff, 0xff, 0xff, 0x0d, 0x02, 0x80, 0xff, 0xff,
+    0xff, 0x0c, 0x03, 0x80, 0xff, 0xff, 0xff, 0x0b, 0x04, 0x80, 0xff, 0xff, 0xff, 0x0a, 0x05, 0x80,
+    0xff, 0xff, 0xff, 0x09, 0x06, 0x80, 0xff, 0xff, 0xff, 0x08, 0x07, 0x80, 0xff, 0xff, 0xff, 0x07,
+    0x08, 0x80, 0xff, 0xff, 0xff, 0x06, 0x09, 0x80, 0xff, 0xff, 0xff, 0x05, 0x0a, 0x80, 0xff, 0xff,
+    0xff, 0x04, 0x0b, 0x80, 0xff, 0xff, 0xff, 0x03, 0x0c, 0x80, 0xff, 0xff, 0xff, 0x02, 0x0d, 0x80,
+    0xff, 0xff, 0xff, 0x01, 0x0e, 0x81, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x0f, 0x80, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x45, 0x46, 0x41, 0x4e, 0x01, 0x96, 0x64, 0x00, 0x05, 0x00, 0x00, 0x00,
+    0xea, 0x01, 0x00, 0x00, 0x4c, 0x6f, 0x6e, 0x67, 0x20, 0x73, 0x74, 0x72, 0x69, 0x70, 0x20, 0x6e,
+    0x61, 0x6d, 0x65, 0x00, 0x7f, 0x0a, 0x14, 0x1e, 0x7f, 0x0a, 0x14, 0x1e, 0x55, 0x0a, 0x14, 0x1e,
+    0xbf, 0x00, 0xff, 0x00, 0x01, 0xfe, 0x07, 0x02, 0xfd, 0x0e, 0x03, 0xfc, 0x15, 0x04, 0xfb, 0x1c,
+    0x05, 0xfa, 0x23, 0x06, 0xf9, 0x2a, 0x07, 0xf8, 0x31, 0x08, 0xf7, 0x38, 0x09, 0xf6, 0x3f, 0x0a,
+    0xf5, 0x46, 0x0b, 0xf4, 0x4d, 0x0c, 0xf3, 0x54, 0x0d, 0xf2, 0x5b, 0x0e, 0xf1, 0x62, 0x0f, 0xf0,
+    0x69, 0x10, 0xef, 0x70, 0x11, 0xee, 0x77, 0x12, 0xed, 0x7e, 0x13, 0xec, 0x85, 0x14, 0xeb, 0x8c,
+    0x15, 0xea, 0x93, 0x16, 0xe9, 0x9a, 0x17, 0xe8, 0xa1, 0x18, 0xe7, 0xa8, 0x19, 0xe6, 0xaf, 0x1a,
+    0xe5, 0xb6, 0x1b, 0xe4, 0xbd, 0x1c, 0xe3, 0xc4, 0x1d, 0xe2, 0xcb, 0x1e, 0xe1, 0xd2, 0x1f, 0xe0,
+    0xd9, 0x20, 0xdf, 0xe0, 0x21, 0xde, 0xe7, 0x22, 0xdd, 0xee, 0x23, 0xdc, 0xf5, 0x24, 0xdb, 0xfc,
+    0x25, 0xda, 0x03, 0x26, 0xd9, 0x0a, 0x27, 0xd8, 0x11, 0x28, 0xd7, 0x18, 0x29, 0xd6, 0x1f, 0x2a,
+    0xd5, 0x26, 0x2b, 0xd4, 0x2d, 0x2c, 0xd3, 0x34, 0x2d, 0xd2, 0x3b, 0x2e, 0xd1, 0x42, 0x2f, 0xd0,
+    0x49, 0x30, 0xcf, 0x50, 0x31, 0xce, 0x57, 0x32, 0xcd, 0x5e, 0x33, 0xcc, 0x65, 0x34, 0xcb, 0x6c,
+    0x35, 0xca, 0x73, 0x36, 0xc9, 0x7a, 0x37, 0xc8, 0x81, 0x38, 0xc7, 0x88, 0x39, 0xc6, 0x8f, 0x3a,
+    0xc5, 0x96, 0x3b, 0xc4, 0x9d, 0x3c, 0xc3, 0xa4, 0x3d, 0xc2, 0xab, 0x3e, 0xc1, 0xb2, 0x3f, 0xc0,
+    0xb9, 0xbf, 0x40, 0xbf, 0xc0, 0x41, 0xbe, 0xc7, 0x42, 0xbd, 0xce, 0x43, 0xbc, 0xd5, 0x44, 0xbb,
+    0xdc, 0x45, 0xba, 0xe3, 0x46, 0xb9, 0xea, 0x47, 0xb8, 0xf1, 0x48, 0xb7, 0xf8, 0x49, 0xb6, 0xff,
+    0x4a, 0xb5, 0x06, 0x4b, 0xb4, 0x0d, 0x4c, 0xb3, 0x14, 0x4d, 0xb2, 0x1b, 0x4e, 0xb1, 0x22, 0x4f,
+    0xb0, 0x29, 0x50, 0xaf, 0x30, 0x51, 0xae, 0x37, 0x52, 0xad, 0x3e, 0x53, 0xac, 0x45, 0x54, 0xab,
+    0x4c, 0x55, 0xaa, 0x53, 0x56, 0xa9, 0x5a, 0x57, 0xa8, 0x61, 0x58, 0xa7, 0x68, 0x59, 0xa6, 0x6f,
+    0x5a, 0xa5, 0x76, 0x5b, 0xa4, 0x7d, 0x5c, 0xa3, 0x84, 0x5d, 0xa2, 0x8b, 0x5e, 0xa1, 0x92, 0x5f,
+    0xa0, 0x99, 0x60, 0x9f, 0xa0, 0x61, 0x9e, 0xa7, 0x62, 0x9d, 0xae, 0x63, 0x9c, 0xb5, 0x64, 0x9b,
+    0xbc, 0x65, 0x9a, 0xc3, 0x66, 0x99, 0xca, 0x67, 0x98, 0xd1, 0x68, 0x97, 0xd8, 0x69, 0x96, 0xdf,
+    0x6a, 0x95, 0xe6, 0x6b, 0x94, 0xed, 0x6c, 0x93, 0xf4, 0x6d, 0x92, 0xfb, 0x6e, 0x91, 0x02, 0x6f,
+    0x90, 0x09, 0x70, 0x8f, 0x10, 0x71, 0x8e, 0x17, 0x72, 0x8d, 0x1e, 0x73, 0x8c, 0x25, 0x74, 0x8b,
+    0x2c, 0x75, 0x8a, 0x33, 0x76, 0x89, 0x3a, 0x77, 0x88, 0x41, 0x78, 0x87, 0x48, 0x79, 0x86, 0x4f,
+    0x7a, 0x85, 0x56, 0x7b, 0x84, 0x5d, 0x7c, 0x83, 0x64, 0x7d, 0x82, 0x6b, 0x7e, 0x81, 0x72, 0x7f,
+    0x80, 0x79, 0x95, 0x80, 0x7f, 0x80, 0x81, 0x7e, 0x87, 0x82, 0x7d, 0x8e, 0x83, 0x7c, 0x95, 0x84,
+    0x7b, 0x9c, 0x85, 0x7a, 0xa3, 0x86, 0x79, 0xaa, 0x87, 0x78, 0xb1, 0x88, 0x77, 0xb8, 0x89, 0x76,
+    0xbf, 0x8a, 0x75, 0xc6, 0x8b, 0x74, 0xcd, 0x8c, 0x73, 0xd4, 0x8d, 0x72, 0xdb, 0x8e, 0x71, 0xe2,
+    0x8f, 0x70, 0xe9, 0x90, 0x6f, 0xf0, 0x91, 0x6e, 0xf7, 0x92, 0x6d, 0xfe, 0x93, 0x6c, 0x05, 0x94,
+    0x6b, 0x0c, 0x95, 0x6a, 0x13, 0x3f, 0x3f, 0x15, 0x7f, 0x0a, 0x14, 0x1e, 0x45, 0x0a, 0x14, 0x1e,
+    0x3f, 0x0f, 0x7f, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xff, 0xff,
+};
+
+/**
+ * @brief Source frames of "Sparkle", RGB
+ */
+static const uint8_t ANIMATION_FIXTURE_FRAMES_0[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x73, 0x43,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xd0, 0x7a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x43, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0x49, 0x00, 0x00, 0x00,
+    0x5b, 0x73, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0xd0, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0x43, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0x49,
+    0x00, 0x00, 0x00, 0x5b, 0x73, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0x8a, 0x77, 0xe5, 0x00, 0x00, 0x00, 0x53, 0x43,
+    0x60, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6b, 0x6d, 0x49, 0x00, 0x00, 0x00, 0x5b, 0x73, 0x43, 0x00, 0x00, 0x00, 0xa1, 0x42, 0x5a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0x8a, 0x77, 0xe5, 0x00, 0x00,
+    0x00, 0x53, 0x43, 0x60, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x6b, 0x6d, 0x49, 0x00, 0x00, 0x00, 0x5b, 0x73, 0x43, 0x00, 0x00, 0x00, 0xa1,
+    0x42, 0x5a, 0x00, 0x00, 0x00, 0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0x8a, 0x77,
+    0xe5, 0xdb, 0xf9, 0xbf, 0x53, 0x43, 0x60, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0x49, 0x00, 0x00, 0x00, 0x5b, 0x73, 0x43, 0x00,
+    0x00, 0x00, 0xc1, 0x83, 0xc5, 0x00, 0x00, 0x00, 0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a, 0x00, 0x00,
+    0x00, 0x8a, 0x77, 0xe5, 0xdb, 0xf9, 0xbf, 0x75, 0x58, 0x9e, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6d, 0x49, 0x00, 0x00, 0x00, 0x5b,
+    0x73, 0x43, 0x00, 0x00, 0x00, 0xc1, 0x83, 0xc5, 0x00, 0x00, 0x00, 0x67, 0xbc, 0x23, 0x0e, 0xd0,
+    0x7a, 0x00, 0x00, 0x00, 0x8a, 0x77, 0xe5, 0x69, 0xe5, 0xda, 0xd7, 0x0f, 0x71, 0x00, 0x00, 0x00,
+    0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xa5, 0xb7, 0x00,
+    0x00, 0x00, 0x5b, 0x73, 0x43, 0x36, 0xff, 0x4c, 0xc1, 0x83, 0xc5, 0x76, 0x78, 0x11, 0x67, 0xbc,
+    0x23, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0x8a, 0x77, 0xe5, 0x69, 0xe5, 0xda, 0xd7, 0x0f, 0x71,
+    0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
+    0xa5, 0xb7, 0x00, 0x00, 0x00, 0xde, 0xd0, 0x81, 0x36, 0xff, 0x4c, 0xc1, 0x83, 0xc5, 0x76, 0x78,
+    0x11, 0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0x8a, 0x77, 0xe5, 0x69, 0xe5, 0xda,
+    0xd7, 0x0f, 0x71, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xe9, 0xbb, 0x1f, 0xa5, 0xb7, 0x00, 0x00, 0x00, 0xde, 0xd0, 0x81, 0x36, 0xff, 0x4c, 0xc1, 0x83,
+    0xc5, 0x76, 0x78, 0x11, 0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0x8a, 0x77, 0xe5,
+    0x69, 0xe5, 0xda, 0xd7, 0x0f, 0x71, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xe9, 0xbb, 0x1f, 0xa5, 0xb7, 0x00, 0x00, 0x00, 0xde, 0xd0, 0x81, 0x36, 0xff,
+    0x4c, 0xc1, 0x83, 0xc5, 0x76, 0x78, 0x11, 0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00,
+    0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xd7, 0x0f, 0x71, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe9, 0xbb, 0x1f, 0xa5, 0xb7, 0x00, 0x00, 0x00, 0xde, 0xd0,
+    0x81, 0x36, 0xff, 0x4c, 0xc1, 0x83, 0xc5, 0x76, 0x78, 0x11, 0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a,
+    0x00, 0x00, 0x00, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xd7, 0x0f, 0x71, 0x00, 0x00, 0x00, 0x66,
+    0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe9, 0xbb, 0x1f, 0xa5, 0xb7, 0x00, 0x00,
+    0x00, 0xde, 0xd0, 0x81, 0x36, 0xff, 0x4c, 0xc1, 0x83, 0xc5, 0x76, 0x78, 0x11, 0x67, 0xbc, 0x23,
+    0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00,
+    0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe9, 0xbb, 0x1f, 0xa5,
+    0xb7, 0x00, 0x00, 0x00, 0xde, 0xd0, 0x81, 0x36, 0xff, 0x4c, 0x57, 0x2c, 0xe6, 0x76, 0x78, 0x11,
+    0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a, 0x00, 0x00, 0x00, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4,
+    0x24, 0x4e, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe9,
+    0xbb, 0xf6, 0xc8, 0xcd, 0x00, 0x00, 0x00, 0xde, 0xd0, 0x81, 0x36, 0xff, 0x4c, 0x23, 0xa8, 0x7b,
+    0x76, 0x78, 0x11, 0x67, 0xbc, 0x23, 0x0e, 0xd0, 0x7a, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69,
+    0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xe9, 0xbb, 0xf6, 0xc8, 0xcd, 0x00, 0x00, 0x00, 0xcb, 0x94, 0xc8, 0x36, 0xff, 0x4c,
+    0x23, 0xa8, 0x7b, 0x76, 0x78, 0x11, 0x2e, 0xcc, 0x7c, 0x0e, 0xd0, 0x7a, 0xbf, 0x2d, 0xaa, 0xce,
+    0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xe9, 0xbb, 0xf6, 0xc8, 0xcd, 0x00, 0x00, 0x00, 0xcb, 0x94, 0xc8,
+    0x36, 0xff, 0x4c, 0x23, 0xa8, 0x7b, 0x9b, 0xf6, 0x67, 0x2e, 0xcc, 0x7c, 0x0e, 0xd0, 0x7a, 0xbf,
+    0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00, 0x00, 0x66, 0x06,
+    0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe9, 0xbb, 0xf6, 0xc8, 0xcd, 0x00, 0x00, 0x00,
+    0xcb, 0x94, 0xc8, 0x36, 0xff, 0x4c, 0x23, 0xa8, 0x7b, 0xf3, 0x0f, 0xed, 0x2e, 0xcc, 0x7c, 0x0e,
+    0xd0, 0x7a, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00,
+    0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe9, 0xbb, 0xf6, 0xc8, 0xcd,
+    0x00, 0x00, 0x00, 0xcb, 0x94, 0xc8, 0x36, 0xff, 0x4c, 0x23, 0xa8, 0x7b, 0xf3, 0x0f, 0xed, 0x24,
+    0x3e, 0xd1, 0x0e, 0xd0, 0x7a, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24,
+    0x4e, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe9, 0xbb,
+    0xf6, 0xc8, 0xcd, 0x00, 0x00, 0x00, 0xcb, 0x94, 0xc8, 0x36, 0xff, 0x4c, 0x23, 0xa8, 0x7b, 0xf3,
+    0x0f, 0xed, 0x24, 0x3e, 0xd1, 0x0e, 0xd0, 0x7a, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5,
+    0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xe9, 0xbb, 0xf6, 0xc8, 0xcd, 0x00, 0x00, 0x00, 0xcb, 0x94, 0xc8, 0x36, 0xff, 0x4c, 0x23,
+    0xa8, 0x7b, 0xf3, 0x0f, 0xed, 0x24, 0x3e, 0xd1, 0x0e, 0xd0, 0x7a, 0xbf, 0x2d, 0xaa, 0xce, 0x64,
+    0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00, 0x00, 0x66, 0x06, 0x91, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x00, 0x00, 0x00, 0xcb, 0x94, 0xc8, 0x36,
+    0xff, 0x4c, 0x23, 0xa8, 0x7b, 0xf3, 0x0f, 0xed, 0x24, 0x3e, 0xd1, 0x3b, 0x3d, 0xbe, 0xbf, 0x2d,
+    0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00, 0x00, 0x20, 0x67, 0x51,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x00, 0x00, 0x00, 0xcb,
+    0x94, 0xc8, 0x36, 0xff, 0x4c, 0xe7, 0xce, 0xfe, 0xf3, 0x0f, 0xed, 0x24, 0x3e, 0xd1, 0x3b, 0x3d,
+    0xbe, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0x00, 0x00, 0x00,
+    0x71, 0xb7, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x00,
+    0x00, 0x00, 0xcb, 0x94, 0xc8, 0x36, 0xff, 0x4c, 0xe7, 0xce, 0xfe, 0xf3, 0x0f, 0xed, 0x24, 0x3e,
+    0xd1, 0x3b, 0x3d, 0xbe, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e,
+    0x00, 0x00, 0x00, 0x71, 0xb7, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x6a, 0x11, 0xf7,
+    0xaf, 0xa7, 0x00, 0x00, 0x00, 0xcb, 0x94, 0xc8, 0xc6, 0x13, 0x8c, 0xe7, 0xce, 0xfe, 0xf3, 0x0f,
+    0xed, 0x24, 0x3e, 0xd1, 0x3b, 0x3d, 0xbe, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda,
+    0xe4, 0x24, 0x4e, 0xa2, 0x11, 0xa7, 0x71, 0xb7, 0xc6, 0x72, 0xbe, 0xa1, 0xa3, 0xc7, 0x54, 0xb6,
+    0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x8d, 0xbe, 0x4c, 0xcb, 0x94, 0xc8, 0xc6, 0x13, 0x8c, 0xe7, 0xce,
+    0xfe, 0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1, 0x3b, 0x3d, 0xbe, 0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34,
+    0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0xa2, 0x11, 0xa7, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3,
+    0xc7, 0x54, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x8d, 0xbe, 0x4c, 0xcb, 0x94, 0xc8, 0xc6, 0x13,
+    0x8c, 0xc3, 0x02, 0x11, 0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1, 0x3b, 0x3d, 0xbe, 0xbf, 0x2d, 0xaa,
+    0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0xa2, 0x11, 0xa7, 0x80, 0x84, 0xd1, 0xa2,
+    0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x8d, 0xbe, 0x4c, 0xcb, 0x94,
+    0xc8, 0xc6, 0x13, 0x8c, 0xc3, 0x02, 0x11, 0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1, 0x2a, 0xf4, 0x52,
+    0xbf, 0x2d, 0xaa, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0xa2, 0x11, 0xa7, 0x80,
+    0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x8d, 0xbe,
+    0x4c, 0x7b, 0xe9, 0x5c, 0xc6, 0x13, 0x8c, 0xe7, 0x96, 0xa9, 0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1,
+    0x2a, 0xf4, 0x52, 0xc2, 0x8e, 0x6e, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4, 0x24, 0x4e, 0xa2,
+    0x11, 0xa7, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0xb6, 0x6a, 0x11, 0xf7, 0xaf,
+    0xa7, 0x8d, 0xbe, 0x4c, 0x7b, 0xe9, 0x5c, 0xc1, 0x27, 0xd9, 0xe7, 0x96, 0xa9, 0x52, 0xbe, 0xfd,
+    0x24, 0x3e, 0xd1, 0x2a, 0xf4, 0x52, 0xc2, 0x8e, 0x6e, 0xce, 0x64, 0x34, 0x69, 0xe5, 0xda, 0xe4,
+    0x24, 0x4e, 0xa2, 0x11, 0xa7, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0xb6, 0x6a,
+    0x11, 0xf7, 0xaf, 0xa7, 0x8d, 0xbe, 0x4c, 0x7b, 0xe9, 0x5c, 0xc1, 0x27, 0xd9, 0xe7, 0x96, 0xa9,
+    0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1, 0x2a, 0xf4, 0x52, 0xc2, 0x8e, 0x6e, 0xce, 0x64, 0x34, 0xe0,
+    0x65, 0x67, 0xe4, 0x24, 0x4e, 0x8b, 0x81, 0x44, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7,
+    0x54, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x8d, 0xbe, 0x4c, 0x7b, 0xe9, 0x5c, 0xc1, 0x27, 0xd9,
+    0x1e, 0x9b, 0x71, 0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1, 0x2a, 0xf4, 0x52, 0xc2, 0x8e, 0x6e, 0xce,
+    0x64, 0x34, 0xe0, 0x65, 0x67, 0xe4, 0x24, 0x4e, 0x8b, 0x81, 0x44, 0x80, 0x84, 0xd1, 0xa2, 0x3f,
+    0xfc, 0xa3, 0xc7, 0x54, 0xb6, 0x6a, 0x11, 0xf7, 0xaf, 0xa7, 0x78, 0xf8, 0xc6, 0x7b, 0xe9, 0x5c,
+    0xc1, 0x27, 0xd9, 0x1e, 0x9b, 0x71, 0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1, 0x2a, 0xf4, 0x52, 0xc2,
+    0x8e, 0x6e, 0xce, 0x64, 0x34, 0xe0, 0x65, 0x67, 0xe4, 0x24, 0x4e, 0x8b, 0x81, 0x44, 0x80, 0x84,
+    0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0x78, 0x23, 0x97, 0xd7, 0x05, 0x81, 0x78, 0xf8, 0xc6,
+    0x7b, 0xe9, 0x5c, 0xc1, 0x27, 0xd9, 0x1e, 0x9b, 0x71, 0x52, 0xbe, 0xfd, 0x24, 0x3e, 0xd1, 0x2a,
+    0xf4, 0x52, 0xc2, 0x8e, 0x6e, 0xce, 0x64, 0x34, 0xe0, 0x65, 0x67, 0xe4, 0x24, 0x4e, 0x8b, 0x81,
+    0x44, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0x78, 0x23, 0x97, 0xd7, 0x05, 0x81,
+    0x78, 0xf8, 0xc6, 0x7b, 0xe9, 0x5c, 0xc1, 0x27, 0xd9, 0x1e, 0x9b, 0x71, 0x52, 0xbe, 0xfd, 0x9b,
+    0xf1, 0x75, 0x2a, 0xf4, 0x52, 0xc2, 0x8e, 0x6e, 0x7f, 0x0e, 0x49, 0xe0, 0x65, 0x67, 0xe4, 0x24,
+    0x4e, 0x8e, 0x5f, 0x1e, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0x78, 0x23, 0x97,
+    0xd7, 0x05, 0x81, 0x78, 0xf8, 0xc6, 0x7b, 0xe9, 0x5c, 0xc1, 0x27, 0xd9, 0x1e, 0x9b, 0x71, 0x52,
+    0xbe, 0xfd, 0x9b, 0xf1, 0x75, 0x2a, 0xf4, 0x52, 0xa7, 0xcc, 0x81, 0x7f, 0x0e, 0x49, 0xe0, 0x65,
+    0x67, 0xe4, 0x24, 0x4e, 0x8e, 0x5f, 0x1e, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54,
+    0x78, 0x23, 0x97, 0xd7, 0x05, 0x81, 0x78, 0xf8, 0xc6, 0x7b, 0xe9, 0x5c, 0xc1, 0x27, 0xd9, 0x1e,
+    0x9b, 0x71, 0x52, 0xbe, 0xfd, 0x9b, 0xf1, 0x75, 0x2a, 0xf4, 0x52, 0xa7, 0xcc, 0x81, 0x7f, 0x0e,
+    0x49, 0xe0, 0x65, 0x67, 0xe4, 0x24, 0x4e, 0x8e, 0x5f, 0x1e, 0x80, 0x84, 0xd1, 0xa2, 0x3f, 0xfc,
+    0xa3, 0xc7, 0x54, 0x78, 0x23, 0x97, 0xd7, 0x05, 0x81, 0x78, 0xf8, 0xc6, 0x7b, 0xe9, 0x5c, 0xc1,
+    0x27, 0xd9, 0x1e, 0x9b, 0x71, 0x52, 0xbe, 0xfd, 0xac, 0xd5, 0x04, 0x2a, 0xf4, 0x52, 0xa7, 0xcc,
+    0x81, 0x7f, 0x0e, 0x49, 0xe0, 0x65, 0x67, 0xe4, 0x24, 0x4e, 0x8e, 0x5f, 0x1e, 0x80, 0x84, 0xd1,
+    0xa2, 0x3f, 0xfc, 0xa3, 0xc7, 0x54, 0x78, 0x23, 0x97, 0xd7, 0x05, 0x81, 0x78, 0xf8, 0xc6, 0x7b,
+    0xe9, 0x5c, 0xce, 0x8f, 0xb6, 0x1e, 0x9b, 0x71,
+};
+
+/**
+ * @brief Source frames of "Wipe", RGB
+ */
+static const uint8_t ANIMATION_FIXTURE_FRAMES_1[] = {
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00,
+    0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+/**
+ * @brief Source frames of "Long strip name", RGB
+ */
+static const uint8_t ANIMATION_FIXTURE_FRAMES_2[] = {
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x00, 0xff, 0x00, 0x01, 0xfe, 0x07, 0x02, 0xfd, 0x0e, 0x03, 0xfc, 0x15, 0x04, 0xfb,
+    0x1c, 0x05, 0xfa, 0x23, 0x06, 0xf9, 0x2a, 0x07, 0xf8, 0x31, 0x08, 0xf7, 0x38, 0x09, 0xf6, 0x3f,
+    0x0a, 0xf5, 0x46, 0x0b, 0xf4, 0x4d, 0x0c, 0xf3, 0x54, 0x0d, 0xf2, 0x5b, 0x0e, 0xf1, 0x62, 0x0f,
+    0xf0, 0x69, 0x10, 0xef, 0x70, 0x11, 0xee, 0x77, 0x12, 0xed, 0x7e, 0x13, 0xec, 0x85, 0x14, 0xeb,
+    0x8c, 0x15, 0xea, 0x93, 0x16, 0xe9, 0x9a, 0x17, 0xe8, 0xa1, 0x18, 0xe7, 0xa8, 0x19, 0xe6, 0xaf,
+    0x1a, 0xe5, 0xb6, 0x1b, 0xe4, 0xbd, 0x1c, 0xe3, 0xc4, 0x1d, 0xe2, 0xcb, 0x1e, 0xe1, 0xd2, 0x1f,
+    0xe0, 0xd9, 0x20, 0xdf, 0xe0, 0x21, 0xde, 0xe7, 0x22, 0xdd, 0xee, 0x23, 0xdc, 0xf5, 0x24, 0xdb,
+    0xfc, 0x25, 0xda, 0x03, 0x26, 0xd9, 0x0a, 0x27, 0xd8, 0x11, 0x28, 0xd7, 0x18, 0x29, 0xd6, 0x1f,
+    0x2a, 0xd5, 0x26, 0x2b, 0xd4, 0x2d, 0x2c, 0xd3, 0x34, 0x2d, 0xd2, 0x3b, 0x2e, 0xd1, 0x42, 0x2f,
+    0xd0, 0x49, 0x30, 0xcf, 0x50, 0x31, 0xce, 0x57, 0x32, 0xcd, 0x5e, 0x33, 0xcc, 0x65, 0x34, 0xcb,
+    0x6c, 0x35, 0xca, 0x73, 0x36, 0xc9, 0x7a, 0x37, 0xc8, 0x81, 0x38, 0xc7, 0x88, 0x39, 0xc6, 0x8f,
+    0x3a, 0xc5, 0x96, 0x3b, 0xc4, 0x9d, 0x3c, 0xc3, 0xa4, 0x3d, 0xc2, 0xab, 0x3e, 0xc1, 0xb2, 0x3f,
+    0xc0, 0xb9, 0x40, 0xbf, 0xc0, 0x41, 0xbe, 0xc7, 0x42, 0xbd, 0xce, 0x43, 0xbc, 0xd5, 0x44, 0xbb,
+    0xdc, 0x45, 0xba, 0xe3, 0x46, 0xb9, 0xea, 0x47, 0xb8, 0xf1, 0x48, 0xb7, 0xf8, 0x49, 0xb6, 0xff,
+    0x4a, 0xb5, 0x06, 0x4b, 0xb4, 0x0d, 0x4c, 0xb3, 0x14, 0x4d, 0xb2, 0x1b, 0x4e, 0xb1, 0x22, 0x4f,
+    0xb0, 0x29, 0x50, 0xaf, 0x30, 0x51, 0xae, 0x37, 0x52, 0xad, 0x3e, 0x53, 0xac, 0x45, 0x54, 0xab,
+    0x4c, 0x55, 0xaa, 0x53, 0x56, 0xa9, 0x5a, 0x57, 0xa8, 0x61, 0x58, 0xa7, 0x68, 0x59, 0xa6, 0x6f,
+    0x5a, 0xa5, 0x76, 0x5b, 0xa4, 0x7d, 0x5c, 0xa3, 0x84, 0x5d, 0xa2, 0x8b, 0x5e, 0xa1, 0x92, 0x5f,
+    0xa0, 0x99, 0x60, 0x9f, 0xa0, 0x61, 0x9e, 0xa7, 0x62, 0x9d, 0xae, 0x63, 0x9c, 0xb5, 0x64, 0x9b,
+    0xbc, 0x65, 0x9a, 0xc3, 0x66, 0x99, 0xca, 0x67, 0x98, 0xd1, 0x68, 0x97, 0xd8, 0x69, 0x96, 0xdf,
+    0x6a, 0x95, 0xe6, 0x6b, 0x94, 0xed, 0x6c, 0x93, 0xf4, 0x6d, 0x92, 0xfb, 0x6e, 0x91, 0x02, 0x6f,
+    0x90, 0x09, 0x70, 0x8f, 0x10, 0x71, 0x8e, 0x17, 0x72, 0x8d, 0x1e, 0x73, 0x8c, 0x25, 0x74, 0x8b,
+    0x2c, 0x75, 0x8a, 0x33, 0x76, 0x89, 0x3a, 0x77, 0x88, 0x41, 0x78, 0x87, 0x48, 0x79, 0x86, 0x4f,
+    0x7a, 0x85, 0x56, 0x7b, 0x84, 0x5d, 0x7c, 0x83, 0x64, 0x7d, 0x82, 0x6b, 0x7e, 0x81, 0x72, 0x7f,
+    0x80, 0x79, 0x80, 0x7f, 0x80, 0x81, 0x7e, 0x87, 0x82, 0x7d, 0x8e, 0x83, 0x7c, 0x95, 0x84, 0x7b,
+    0x9c, 0x85, 0x7a, 0xa3, 0x86, 0x79, 0xaa, 0x87, 0x78, 0xb1, 0x88, 0x77, 0xb8, 0x89, 0x76, 0xbf,
+    0x8a, 0x75, 0xc6, 0x8b, 0x74, 0xcd, 0x8c, 0x73, 0xd4, 0x8d, 0x72, 0xdb, 0x8e, 0x71, 0xe2, 0x8f,
+    0x70, 0xe9, 0x90, 0x6f, 0xf0, 0x91, 0x6e, 0xf7, 0x92, 0x6d, 0xfe, 0x93, 0x6c, 0x05, 0x94, 0x6b,
+    0x0c, 0x95, 0x6a, 0x13, 0x00, 0xff, 0x00, 0x01, 0xfe, 0x07, 0x02, 0xfd, 0x0e, 0x03, 0xfc, 0x15,
+    0x04, 0xfb, 0x1c, 0x05, 0xfa, 0x23, 0x06, 0xf9, 0x2a, 0x07, 0xf8, 0x31, 0x08, 0xf7, 0x38, 0x09,
+    0xf6, 0x3f, 0x0a, 0xf5, 0x46, 0x0b, 0xf4, 0x4d, 0x0c, 0xf3, 0x54, 0x0d, 0xf2, 0x5b, 0x0e, 0xf1,
+    0x62, 0x0f, 0xf0, 0x69, 0x10, 0xef, 0x70, 0x11, 0xee, 0x77, 0x12, 0xed, 0x7e, 0x13, 0xec, 0x85,
+    0x14, 0xeb, 0x8c, 0x15, 0xea, 0x93, 0x16, 0xe9, 0x9a, 0x17, 0xe8, 0xa1, 0x18, 0xe7, 0xa8, 0x19,
+    0xe6, 0xaf, 0x1a, 0xe5, 0xb6, 0x1b, 0xe4, 0xbd, 0x1c, 0xe3, 0xc4, 0x1d, 0xe2, 0xcb, 0x1e, 0xe1,
+    0xd2, 0x1f, 0xe0, 0xd9, 0x20, 0xdf, 0xe0, 0x21, 0xde, 0xe7, 0x22, 0xdd, 0xee, 0x23, 0xdc, 0xf5,
+    0x24, 0xdb, 0xfc, 0x25, 0xda, 0x03, 0x26, 0xd9, 0x0a, 0x27, 0xd8, 0x11, 0x28, 0xd7, 0x18, 0x29,
+    0xd6, 0x1f, 0x2a, 0xd5, 0x26, 0x2b, 0xd4, 0x2d, 0x2c, 0xd3, 0x34, 0x2d, 0xd2, 0x3b, 0x2e, 0xd1,
+    0x42, 0x2f, 0xd0, 0x49, 0x30, 0xcf, 0x50, 0x31, 0xce, 0x57, 0x32, 0xcd, 0x5e, 0x33, 0xcc, 0x65,
+    0x34, 0xcb, 0x6c, 0x35, 0xca, 0x73, 0x36, 0xc9, 0x7a, 0x37, 0xc8, 0x81, 0x38, 0xc7, 0x88, 0x39,
+    0xc6, 0x8f, 0x3a, 0xc5, 0x96, 0x3b, 0xc4, 0x9d, 0x3c, 0xc3, 0xa4, 0x3d, 0xc2, 0xab, 0x3e, 0xc1,
+    0xb2, 0x3f, 0xc0, 0xb9, 0x40, 0xbf, 0xc0, 0x41, 0xbe, 0xc7, 0x42, 0xbd, 0xce, 0x43, 0xbc, 0xd5,
+    0x44, 0xbb, 0xdc, 0x45, 0xba, 0xe3, 0x46, 0xb9, 0xea, 0x47, 0xb8, 0xf1, 0x48, 0xb7, 0xf8, 0x49,
+    0xb6, 0xff, 0x4a, 0xb5, 0x06, 0x4b, 0xb4, 0x0d, 0x4c, 0xb3, 0x14, 0x4d, 0xb2, 0x1b, 0x4e, 0xb1,
+    0x22, 0x4f, 0xb0, 0x29, 0x50, 0xaf, 0x30, 0x51, 0xae, 0x37, 0x52, 0xad, 0x3e, 0x53, 0xac, 0x45,
+    0x54, 0xab, 0x4c, 0x55, 0xaa, 0x53, 0x56, 0xa9, 0x5a, 0x57, 0xa8, 0x61, 0x58, 0xa7, 0x68, 0x59,
+    0xa6, 0x6f, 0x5a, 0xa5, 0x76, 0x5b, 0xa4, 0x7d, 0x5c, 0xa3, 0x84, 0x5d, 0xa2, 0x8b, 0x5e, 0xa1,
+    0x92, 0x5f, 0xa0, 0x99, 0x60, 0x9f, 0xa0, 0x61, 0x9e, 0xa7, 0x62, 0x9d, 0xae, 0x63, 0x9c, 0xb5,
+    0x64, 0x9b, 0xbc, 0x65, 0x9a, 0xc3, 0x66, 0x99, 0xca, 0x67, 0x98, 0xd1, 0x68, 0x97, 0xd8, 0x69,
+    0x96, 0xdf, 0x6a, 0x95, 0xe6, 0x6b, 0x94, 0xed, 0x6c, 0x93, 0xf4, 0x6d, 0x92, 0xfb, 0x6e, 0x91,
+    0x02, 0x6f, 0x90, 0x09, 0x70, 0x8f, 0x10, 0x71, 0x8e, 0x17, 0x72, 0x8d, 0x1e, 0x73, 0x8c, 0x25,
+    0x74, 0x8b, 0x2c, 0x75, 0x8a, 0x33, 0x76, 0x89, 0x3a, 0x77, 0x88, 0x41, 0x78, 0x87, 0x48, 0x79,
+    0x86, 0x4f, 0x7a, 0x85, 0x56, 0x7b, 0x84, 0x5d, 0x7c, 0x83, 0x64, 0x7d, 0x82, 0x6b, 0x7e, 0x81,
+    0x72, 0x7f, 0x80, 0x79, 0x80, 0x7f, 0x80, 0x81, 0x7e, 0x87, 0x82, 0x7d, 0x8e, 0x83, 0x7c, 0x95,
+    0x84, 0x7b, 0x9c, 0x85, 0x7a, 0xa3, 0x86, 0x79, 0xaa, 0x87, 0x78, 0xb1, 0x88, 0x77, 0xb8, 0x89,
+    0x76, 0xbf, 0x8a, 0x75, 0xc6, 0x8b, 0x74, 0xcd, 0x8c, 0x73, 0xd4, 0x8d, 0x72, 0xdb, 0x8e, 0x71,
+    0xe2, 0x8f, 0x70, 0xe9, 0x90, 0x6f, 0xf0, 0x91, 0x6e, 0xf7, 0x92, 0x6d, 0xfe, 0x93, 0x6c, 0x05,
+    0x94, 0x6b, 0x0c, 0x95, 0x6a, 0x13, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14,
+    0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e,
+    0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a,
+    0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x0a, 0x14, 0x1e, 0x46, 0xb9, 0xea, 0x47, 0xb8, 0xf1, 0x48, 0xb7,
+    0xf8, 0x49, 0xb6, 0xff, 0x4a, 0xb5, 0x06, 0x4b, 0xb4, 0x0d, 0x4c, 0xb3, 0x14, 0x4d, 0xb2, 0x1b,
+    0x4e, 0xb1, 0x22, 0x4f, 0xb0, 0x29, 0x50, 0xaf, 0x30, 0x51, 0xae, 0x37, 0x52, 0xad, 0x3e, 0x53,
+    0xac, 0x45, 0x54, 0xab, 0x4c, 0x55, 0xaa, 0x53, 0x56, 0xa9, 0x5a, 0x57, 0xa8, 0x61, 0x58, 0xa7,
+    0x68, 0x59, 0xa6, 0x6f, 0x5a, 0xa5, 0x76, 0x5b, 0xa4, 0x7d, 0x5c, 0xa3, 0x84, 0x5d, 0xa2, 0x8b,
+    0x5e, 0xa1, 0x92, 0x5f, 0xa0, 0x99, 0x60, 0x9f, 0xa0, 0x61, 0x9e, 0xa7, 0x62, 0x9d, 0xae, 0x63,
+    0x9c, 0xb5, 0x64, 0x9b, 0xbc, 0x65, 0x9a, 0xc3, 0x66, 0x99, 0xca, 0x67, 0x98, 0xd1, 0x68, 0x97,
+    0xd8, 0x69, 0x96, 0xdf, 0x6a, 0x95, 0xe6, 0x6b, 0x94, 0xed, 0x6c, 0x93, 0xf4, 0x6d, 0x92, 0xfb,
+    0x6e, 0x91, 0x02, 0x6f, 0x90, 0x09, 0x70, 0x8f, 0x10, 0x71, 0x8e, 0x17, 0x72, 0x8d, 0x1e, 0x73,
+    0x8c, 0x25, 0x74, 0x8b, 0x2c, 0x75, 0x8a, 0x33, 0x76, 0x89, 0x3a, 0x77, 0x88, 0x41, 0x78, 0x87,
+    0x48, 0x79, 0x86, 0x4f, 0x7a, 0x85, 0x56, 0x7b, 0x84, 0x5d, 0x7c, 0x83, 0x64, 0x7d, 0x82, 0x6b,
+    0x7e, 0x81, 0x72, 0x7f, 0x80, 0x79, 0x80, 0x7f, 0x80, 0x81, 0x7e, 0x87, 0x82, 0x7d, 0x8e, 0x83,
+    0x7c, 0x95, 0x84, 0x7b, 0x9c, 0x85, 0x7a, 0xa3, 0x86, 0x79, 0xaa, 0x87, 0x78, 0xb1, 0x88, 0x77,
+    0xb8, 0x89, 0x76, 0xbf, 0x8a, 0x75, 0xc6, 0x8b, 0x74, 0xcd, 0x8c, 0x73, 0xd4, 0x8d, 0x72, 0xdb,
+    0x8e, 0x71, 0xe2, 0x8f, 0x70, 0xe9, 0x90, 0x6f, 0xf0, 0x91, 0x6e, 0xf7, 0x92, 0x6d, 0xfe, 0x93,
+    0x6c, 0x05, 0x94, 0x6b, 0x0c, 0x95, 0x6a, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+/**
+ * @brief Source of an animation inside ANIMATION_FIXTURE_IMAGE
+ */
+struct AnimationFixture {
+    const char* name;       //!< Name of the animation
+    uint16_t frame_ms;      //!< Duration of a single frame
+    uint8_t num_leds;       //!< Number of LEDs per frame
+    uint16_t num_frames;    //!< Number of frames
+    const uint8_t* frames;  //!< All frames, RGB
+};
+
+static const AnimationFixture ANIMATION_FIXTURES[] = {
+    {"Sparkle", 50, 17, 40, ANIMATION_FIXTURE_FRAMES_0},
+    {"Wipe", 20, 17, 68, ANIMATION_FIXTURE_FRAMES_1},
+    {"Long strip name", 100, 150, 5, ANIMATION_FIXTURE_FRAMES_2},
+};
+
+#endif /* NATIVE_BENCH_ANIMATION_FIXTURE_H_ */
@@ -0,0 +1,397 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+/**
+ * @brief Benchmark runner for the native environment. Runs every FSM state in
+ * every mode as the FSM would and reports the time per run() together with
+ * the number of heap allocations per tick. Compares state transitions with
+ * heap allocated states to transitions inside FSMStateArena. Finally stress tests the FSM event
+ * queue from two threads, checks EFScheduler against a fake clock and runs
+ * the LED stack checks from checks.cpp. Exits with 1, if events got lost or
+ * corrupted, jobs were scheduled wrongly or any check failed.
+ * Build and run with:
+ *
+ *     pio run -e native && .pio/build/native/program
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include <EFHeap.h>
+#include <EFLed.h>
+#include <EFLedOutputStage.h>
+#include <EFLedPalette.h>
+#include <EFLedTimeline.h>
+#include <EFMath.h>
+#include <EFScheduler.h>
+
+#include "FSMEventQueue.h"
+#include "FSMState.h"
+#include "checks.h"
+
+/**
+ * @brief Number of measured run() calls per state and mode
+ */
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 5000
+#endif
+
+static volatile uint32_t sink;  //!< Keeps results of micro benchmarks alive
+
+/**
+ * @brief Measures the given function and prints a single result line
+ *
+ * @param name Name of the benchmark
+ * @param mode Mode of the benchmark or -1, if there is none
+ * @param iterations Number of calls to fn
+ * @param fn Function to measure
+ */
+static void measure(const char* name, int mode, uint32_t iterations, const std::function<void()>& fn) {
+    const uint32_t allocs_start = EFHeap.getAllocCount();
+    EFHeap.beginTick();
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        fn();
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EFHeap.endTick();
+    const double ns = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    const double allocs = (double) (EFHeap.getAllocCount() - allocs_start) / iterations;
+
+    if (mode < 0) {
+        printf("%-24s %5s %12.1f %12.2f\n", name, "-", ns, allocs);
+    } else {
+        printf("%-24s %5d %12.1f %12.2f\n", name, mode, ns, allocs);
+    }
+}
+
+/**
+ * @brief Benchmarks a single FSM state in all of its modes
+ *
+ * @param make Creates a new instance of the state
+ * @param num_modes Number of modes
+ * @param mode_idx Global selecting the mode or nullptr, if the state has no modes
+ */
+static void benchState(
+    const std::function<FSMStatePtr()>& make,
+    uint8_t num_modes,
+    uint8_t FSMGlobals::* mode_idx
+) {
+    for (uint8_t mode = 0; mode < num_modes; mode++) {
+        std::shared_ptr<FSMGlobals> globals = std::make_shared<FSMGlobals>();
+        if (mode_idx) {
+            globals.get()->*mode_idx = mode;
+        }
+
+        FSMStatePtr state = make();
+        state->attachGlobals(globals);
+        {
+            EFLedFrameGuard frame(EFLed);
+            state->entry();
+            // Warm up, e.g. fill frame caches
+            state->run();
+        }
+
+        measure(state->getName(), mode_idx ? mode : -1, BENCH_ITERATIONS, [&state]() {
+            EFLedFrameGuard frame(EFLed);
+            state->run();
+            // Advance the host clock as the FSM would for time based states
+            delay(state->getTickRateMs());
+        });
+
+        state->exit();
+        EFLed.clear();
+    }
+}
+
+/**
+ * @brief Stress tests FSMEventQueue with a producer and a consumer thread
+ * running at full speed. The timestamp of every event carries a sequence
+ * number, which the consumer checks for order and integrity.
+ *
+ * @param num_events Number of events to push
+ * @return True, if every event was either received intact and in order or
+ * counted as dropped
+ */
+static bool stressEventQueue(uint32_t num_events) {
+    FSMEventQueue queue;
+    std::atomic<bool> done(false);
+    uint32_t received = 0;
+    uint32_t errors = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::thread consumer([&]() {
+        FSMTimedEvent timed;
+        int64_t last = -1;
+        while (!done.load(std::memory_order_acquire) || queue.size() > 0) {
+            if (!queue.pop(timed)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if ((int64_t) timed.timestamp_us <= last || timed.event != (FSMEvent) (timed.timestamp_us % 10 + 1)) {
+                errors++;
+            }
+            last = timed.timestamp_us;
+            received++;
+        }
+    });
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < num_events; i++) {
+            queue.push((FSMEvent) (i % 10 + 1), i);
+            // Give the consumer a chance on hosts with few cores
+            if (i % 16 == 15) {
+                std::this_thread::yield();
+            }
+        }
+        done.store(true, std::memory_order_release);
+    });
+    producer.join();
+    consumer.join();
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    const bool ok = errors == 0 && received + queue.getDroppedCount() == num_events;
+    printf(
+        "%-24s %5s %12.1f %12s received=%u dropped=%u overflows=%u errors=%u %s\n",
+        "FSMEventQueue SPSC",
+        "-",
+        std::chrono::duration<double, std::nano>(elapsed).count() / num_events,
+        "-",
+        received,
+        queue.getDroppedCount(),
+        queue.getOverflowCount(),
+        errors,
+        ok ? "OK" : "FAILED"
+    );
+    return ok;
+}
+
+static unsigned long fake_clock_ms = 0;  //!< Time source of checkScheduler()
+
+/**
+ * @brief Fake clock for EFScheduler that only advances when told to
+ */
+static unsigned long fakeClock() {
+    return fake_clock_ms;
+}
+
+/**
+ * @brief Checks EFScheduler against a fake clock that starts right before
+ * its overflow: periodic jobs must stay phase-locked while the main loop
+ * wakes up at random times, skip periods they missed entirely and one-shot
+ * jobs must run in deadline order.
+ *
+ * @return True, if all jobs ran as expected
+ */
+static bool checkScheduler() {
+    constexpr uint32_t PERIOD_MS = 100;
+    constexpr uint32_t DURATION_MS = 1000000;
+    static uint32_t periodic_runs;
+    static uint32_t oneshot_order[8];
+    static uint8_t oneshot_num;
+
+    EFSchedulerClass scheduler(fakeClock);
+    uint32_t errors = 0;
+    fake_clock_ms = 0xFFFFF000;
+    const uint32_t start_ms = fake_clock_ms;
+
+    // Periodic job, polled at random intervals shorter than its period
+    periodic_runs = 0;
+    const EFSchedulerJobId periodic = scheduler.add("periodic", [](void* ctx) { periodic_runs++; });
+    scheduler.startPeriodic(periodic, PERIOD_MS);
+    srand(42);
+    while ((uint32_t) fake_clock_ms - start_ms < DURATION_MS) {
+        const uint32_t idle_ms = scheduler.run();
+        if (idle_ms == 0 || idle_ms > PERIOD_MS) {
+            errors++;
+        }
+        fake_clock_ms += 1 + rand() % min(idle_ms + 5, PERIOD_MS - 1);
+    }
+    const EFSchedulerJob& job = scheduler.getJob(periodic);
+    if (periodic_runs != DURATION_MS / PERIOD_MS || job.missed != 0 || (job.deadline_ms - start_ms) % PERIOD_MS != 0) {
+        errors++;
+    }
+    const uint32_t late_max_ms = job.late_max_ms;
+
+    // Stall the main loop for 3.5 periods: one run, three skipped, phase kept
+    const uint32_t runs_before = periodic_runs;
+    fake_clock_ms = job.deadline_ms + 3 * PERIOD_MS + PERIOD_MS / 2;
+    scheduler.run();
+    if (periodic_runs != runs_before + 1 || job.missed != 3 || (job.deadline_ms - start_ms) % PERIOD_MS != 0) {
+        errors++;
+    }
+    scheduler.stop(periodic);
+
+    // One-shot jobs in deadline order, one of them stopped
+    oneshot_num = 0;
+    const uint32_t delays[] = {70, 10, 50, 30, 60, 20, 40};
+    EFSchedulerJobId oneshots[7];
+    for (uint8_t i = 0; i < 7; i++) {
+        oneshots[i] = scheduler.add("oneshot", [](void* ctx) {
+            oneshot_order[oneshot_num++] = (uint32_t) (uintptr_t) ctx;
+        }, (void*) (uintptr_t) delays[i]);
+        scheduler.startOnce(oneshots[i], delays[i]);
+    }
+    scheduler.stop(oneshots[4]);
+    for (uint8_t ms = 0; ms <= 80; ms++) {
+        scheduler.run();
+        fake_clock_ms++;
+    }
+    const uint32_t expected[] = {10, 20, 30, 40, 50, 70};
+    for (uint8_t i = 0; i < 6; i++) {
+        if (oneshot_num != 6 || oneshot_order[i] != expected[i]) {
+            errors++;
+            break;
+        }
+    }
+    if (scheduler.getMsUntilNextDeadline() != EFSCHEDULER_NO_DEADLINE) {
+        errors++;
+    }
+
+    const bool ok = errors == 0;
+    printf(
+        "%-24s %5s %12s %12s runs=%u missed=%u late_max=%u ms errors=%u %s\n",
+        "EFScheduler fake clock",
+        "-",
+        "-",
+        "-",
+        periodic_runs,
+        job.missed,
+        late_max_ms,
+        errors,
+        ok ? "OK" : "FAILED"
+    );
+    return ok;
+}
+
+int main() {
+    EFLed.init();
+    EFLed.setBrightnessPercent(40);
+
+    printf("%-24s %5s %12s %12s\n", "benchmark", "mode", "ns/run", "allocs/run");
+
+    // FSM states
+    benchState([]() { return makeState<DisplayPrideFlag>(); }, 13, &FSMGlobals::prideFlagModeIdx);
+    benchState([]() { return makeState<AnimateRainbow>(); }, 3, &FSMGlobals::animRainbowIdx);
+    benchState([]() { return makeState<AnimateMatrix>(); }, 9, &FSMGlobals::animMatrixIdx);
+    benchState([]() { return makeState<AnimateSnake>(); }, 4, &FSMGlobals::animSnakeAnimationIdx);
+    benchState([]() { return makeState<AnimateHeartbeat>(); }, 3, &FSMGlobals::animHeartbeatSpeed);
+    benchState([]() { return makeState<CustomPatternsDisplay>(); }, 4, &FSMGlobals::cstPatternsIdx);
+    benchState([]() { return makeState<VUMeter>(); }, 1, nullptr);
+    benchState([]() { return makeState<MenuMain>(); }, 1, nullptr);
+
+    // State transitions menu <-> rainbow as done by FSM::transition(), with
+    // states allocated on the heap for comparison and inside FSMStateArena
+    std::shared_ptr<FSMGlobals> globals = std::make_shared<FSMGlobals>();
+    bool to_menu = false;
+    std::unique_ptr<FSMState> heap_state = std::make_unique<MenuMain>();
+    measure("Transition heap", -1, BENCH_ITERATIONS, [&]() {
+        std::unique_ptr<FSMState> next;
+        if ((to_menu = !to_menu)) {
+            next = std::make_unique<MenuMain>();
+        } else {
+            next = std::make_unique<AnimateRainbow>();
+        }
+        heap_state->exit();
+        heap_state = std::move(next);
+        heap_state->attachGlobals(globals);
+        heap_state->entry();
+    });
+    heap_state.reset();
+    FSMStatePtr arena_state = makeState<MenuMain>();
+    measure("Transition arena", -1, BENCH_ITERATIONS, [&]() {
+        FSMStatePtr next = (to_menu = !to_menu) ? makeState<MenuMain>() : makeState<AnimateRainbow>();
+        arena_state->exit();
+        arena_state = std::move(next);
+        arena_state->attachGlobals(globals);
+        arena_state->entry();
+    });
+    arena_state.reset();
+    EFLed.clear();
+
+    // Building blocks of the LED stack
+    CRGB leds[EFLED_TOTAL_NUM];
+    uint8_t wire[EFLED_TOTAL_NUM * 3];
+    fill_rainbow(leds, EFLED_TOTAL_NUM, 0, 15);
+
+    EFLedOutputStage stage;
+    stage.setGammaCorrection(true);
+    measure("OutputStage gamma", -1, BENCH_ITERATIONS, [&]() {
+        stage.render(leds, EFLED_TOTAL_NUM, 100, wire);
+        sink = wire[0];
+    });
+    stage.setGammaCorrection(false);
+    measure("OutputStage linear", -1, BENCH_ITERATIONS, [&]() {
+        stage.render(leds, EFLED_TOTAL_NUM, 100, wire);
+        sink = wire[0];
+    });
+
+    uint16_t angle = 0;
+    measure("EFMath::sin x17", -1, BENCH_ITERATIONS, [&]() {
+        for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+            sink = EFMath::sin(angle += 1000);
+        }
+    });
+    float fangle = 0;
+    measure("sinf x17", -1, BENCH_ITERATIONS, [&]() {
+        for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+            sink = (uint32_t) (sinf(fangle += 0.1f) * 32767);
+        }
+    });
+
+    uint8_t value = 0;
+    measure("CHSV to CRGB x17", -1, BENCH_ITERATIONS, [&]() {
+        for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+            leds[i] = CHSV(110, 255, value += 7);
+        }
+        sink = leds[0].g;
+    });
+    const EFLedValueRamp& ramp = EFLedPalette.get(110);
+    measure("EFLedValueRamp x17", -1, BENCH_ITERATIONS, [&]() {
+        for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+            leds[i] = ramp[value += 7];
+        }
+        sink = leds[0].g;
+    });
+
+    // FSM event queue
+    if (!stressEventQueue(BENCH_ITERATIONS * 1000)) {
+        return 1;
+    }
+
+    // Main loop scheduler
+    if (!checkScheduler()) {
+        return 1;
+    }
+
+    // LED stack against known results and reference implementations
+    if (!runChecks()) {
+        return 1;
+    }
+
+    return 0;
+}
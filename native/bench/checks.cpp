@@ -0,0 +1,646 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+/**
+ * Host checks of the LED stack that compare the firmware code against known
+ * results or reference implementations. Run as part of the native bench, see
+ * bench.cpp.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <EFEnergy.h>
+#include <EFLed.h>
+#include <EFLedAnimation.h>
+#include <EFLedFrameCache.h>
+#include <EFLedOutputMock.h>
+#include <EFLedPowerModel.h>
+#include <EFLedRingView.h>
+#include <EFLedTimeline.h>
+#include <EFPrideFlags.h>
+
+#include "FSMState.h"
+#include "animation_fixture.h"
+#include "checks.h"
+
+/**
+ * @brief Prints the result line of a check
+ *
+ * @param name Name of the check
+ * @param errors Number of detected errors
+ * @param detail Additional information to print
+ * @return True, if no errors were detected
+ */
+static bool report(const char* name, uint32_t errors, const char* detail) {
+    printf(
+        "%-24s %5s %12s %12s %s errors=%u %s\n",
+        name,
+        "-",
+        "-",
+        "-",
+        detail,
+        errors,
+        errors == 0 ? "OK" : "FAILED"
+    );
+    return errors == 0;
+}
+
+/**
+ * @brief Steps EFLedOutput through its double buffering with a mock backend
+ * that completes frames only on request. The buffer in flight must neither be
+ * handed out for rendering nor be overwritten before its fence completed.
+ *
+ * @return True, if the fence protected the buffer in flight
+ */
+static bool checkOutputFence() {
+    constexpr uint16_t NUM_BYTES = 51;
+    EFLedOutputMock output(false);
+    uint32_t errors = 0;
+    uint8_t expected[NUM_BYTES];
+    if (!output.begin(0, NUM_BYTES)) {
+        return report("EFLedOutput fence", 1, "begin failed");
+    }
+
+    // Frame A goes into flight and stays there
+    memset(output.backBuffer(), 0xAA, NUM_BYTES);
+    if (!output.submit() || output.getInFlightBuffer() == nullptr) {
+        errors++;
+    }
+    const uint8_t* frame_a = output.getInFlightBuffer();
+
+    // Frame B must be rendered into the other buffer
+    if (output.backBuffer() == frame_a) {
+        errors++;
+    }
+    memset(output.backBuffer(), 0xBB, NUM_BYTES);
+    uint8_t* frame_b = output.backBuffer();
+
+    // A is not complete yet: B is dropped and neither buffer is swapped
+    if (output.submit() || output.getFenceTimeoutCount() != 1 || output.backBuffer() != frame_b) {
+        errors++;
+    }
+    memset(expected, 0xAA, NUM_BYTES);
+    if (output.getInFlightBuffer() != frame_a || memcmp(frame_a, expected, NUM_BYTES) != 0) {
+        errors++;
+    }
+
+    // Once A completed, B is sent and A becomes the back buffer again
+    output.complete();
+    if (!output.submit() || output.getInFlightBuffer() != frame_b || output.backBuffer() != frame_a) {
+        errors++;
+    }
+    memset(expected, 0xBB, NUM_BYTES);
+    if (memcmp(output.getLastFrame(), expected, NUM_BYTES) != 0) {
+        errors++;
+    }
+    output.complete();
+    if (output.isBusy() || output.getSubmittedFrameCount() != 2 || output.getCompletedFrameCount() != 2) {
+        errors++;
+    }
+
+    return report("EFLedOutput fence", errors, "submitted=2");
+}
+
+/**
+ * @brief Keeps a dim static frame on the LEDs across several forced refreshes
+ * with gamma correction and dithering enabled. Each refresh must re-send the
+ * wire data of the first push instead of a new dither phase.
+ *
+ * @return True, if all refreshes were pushed with unchanged wire data
+ */
+static bool checkForcedRefresh() {
+    constexpr uint8_t REFRESHES = 5;
+    EFLedOutputMock output;
+    EFLedOutput* const previous_output = EFLed.getOutput();
+    EFLed.setOutput(&output);
+    EFLed.init(51);
+    EFLed.setBrightnessPercent(40);
+    EFLed.setGammaCorrection(true);
+    EFLed.setDithering(true);
+
+    uint32_t errors = 0;
+    uint8_t first[EFLED_TOTAL_NUM * 3];
+    const CRGB color(40, 24, 8);
+    EFLed.setAllSolid(color);
+    memcpy(first, output.getLastFrame(), sizeof(first));
+    const uint32_t pushed = EFLed.getPushedFrameCount();
+    for (uint8_t i = 0; i < REFRESHES; i++) {
+        delay(EFLED_FORCED_REFRESH_MS_DEFAULT);
+        EFLed.setAllSolid(color);
+        if (memcmp(output.getLastFrame(), first, sizeof(first)) != 0 || EFLed.getFrameDelta() != 0) {
+            printf("Forced refresh %u changed the wire data (delta=%u)\n", i, EFLed.getFrameDelta());
+            errors++;
+        }
+    }
+    if (EFLed.getPushedFrameCount() != pushed + REFRESHES) {
+        printf("Forced refresh: %u of %u refreshes pushed\n", EFLed.getPushedFrameCount() - pushed, REFRESHES);
+        errors++;
+    }
+
+    EFLed.setOutput(previous_output);
+    EFLed.init();
+    EFLed.setGammaCorrection(false);
+
+    char detail[32];
+    snprintf(detail, sizeof(detail), "refreshes=%u", REFRESHES);
+    return report("EFLed forced refresh", errors, detail);
+}
+
+/**
+ * @brief Fades a layer in Replace mode over a base layer. Full opacity must
+ * replace the base, lower opacities must blend with it in proportion.
+ *
+ * @return True, if every step of the fade matched
+ */
+static bool checkCompositorReplace() {
+    constexpr uint8_t NUM_LEDS = 17;
+    const uint8_t opacities[] = {0, 1, 64, 128, 192, 254, 255};
+    EFLedCompositor compositor;
+    CRGB base[NUM_LEDS];
+    CRGB layer[NUM_LEDS];
+    fill_solid(base, NUM_LEDS, CRGB(0, 0, 200));
+    fill_solid(layer, NUM_LEDS, CRGB(200, 0, 0));
+    compositor.init(NUM_LEDS);
+    compositor.setBlendMode(EFLedLayer::Feedback, EFLedBlendMode::Replace);
+    compositor.setPixels(EFLedLayer::Feedback, layer);
+
+    uint32_t errors = 0;
+    uint8_t red_before = 0;
+    for (const uint8_t opacity : opacities) {
+        compositor.setOpacity(EFLedLayer::Feedback, opacity);
+        const CRGB* out = compositor.compose(base);
+        for (uint8_t i = 0; i < NUM_LEDS; i++) {
+            const int expected_red = 200 * opacity / 255;
+            bool ok = abs(out[i].r - expected_red) <= 2 && abs(out[i].r + out[i].b - 200) <= 2 && out[i].r >= red_before;
+            if (opacity == 0) {
+                ok = out[i] == base[i];
+            } else if (opacity == 255) {
+                ok = out[i] == layer[i];
+            }
+            if (!ok) {
+                printf("Compositor: opacity=%u led=%u is (%u, %u, %u)\n", opacity, i, out[i].r, out[i].g, out[i].b);
+                errors++;
+            }
+        }
+        red_before = out[0].r;
+    }
+
+    char detail[32];
+    snprintf(detail, sizeof(detail), "steps=%u", (unsigned) sizeof(opacities));
+    return report("EFLedCompositor replace", errors, detail);
+}
+
+/**
+ * @brief Compares the current estimated by EFLedPowerModel with its default
+ * parameters against a table of hand calculated frames
+ *
+ * @return True, if all estimates and the brightness limit match
+ */
+static bool checkPowerModel() {
+    constexpr uint8_t NUM_LEDS = 17;
+    struct PowerCase {
+        CRGB color;            //!< Color of all LEDs, or of the first LED only if single
+        bool single;           //!< Only the first LED is lit
+        uint8_t brightness;    //!< Global brightness
+        uint32_t expected_ua;  //!< Expected current in uA
+    };
+    const PowerCase cases[] = {
+        {CRGB(0, 0, 0), false, 255, 17000},
+        {CRGB(0, 0, 0), false, 45, 17000},
+        {CRGB(255, 255, 255), false, 255, 629000},
+        {CRGB(255, 255, 255), false, 128, 324200},
+        {CRGB(255, 255, 255), false, 45, 125000},
+        {CRGB(255, 0, 0), true, 255, 29000},
+        {CRGB(0, 0, 255), false, 255, 221000},
+    };
+    EFLedPowerModel model;
+    CRGB frame[NUM_LEDS];
+    uint32_t errors = 0;
+
+    for (const PowerCase& c : cases) {
+        for (uint8_t i = 0; i < NUM_LEDS; i++) {
+            frame[i] = (c.single && i > 0) ? CRGB(0, 0, 0) : c.color;
+        }
+        const uint32_t ua = model.estimateCurrent(frame, NUM_LEDS, c.brightness);
+        if (ua != c.expected_ua) {
+            printf(
+                "Power model: rgb=(%u,%u,%u) single=%d brightness=%u: %u uA, expected %u uA\n",
+                c.color.r, c.color.g, c.color.b, c.single, c.brightness, ua, c.expected_ua
+            );
+            errors++;
+        }
+    }
+
+    // Full white must be dimmed to the old brightness cap of 45 on battery
+    for (uint8_t i = 0; i < NUM_LEDS; i++) {
+        frame[i] = CRGB(255, 255, 255);
+    }
+    const uint8_t limited = model.limitBrightness(frame, NUM_LEDS, 255);
+    if (limited != 45 || model.estimateCurrent(frame, NUM_LEDS, limited) > model.getBudget() * 1000UL) {
+        printf("Power model: full white limited to %u, expected 45\n", limited);
+        errors++;
+    }
+
+    // Gamma correction and white balance lower the duty cycles
+    EFLedPowerModel corrected;
+    corrected.setGammaCorrection(true);
+    corrected.setWhiteBalance(TypicalSMD5050);
+    const uint8_t brightness = corrected.limitBrightness(frame, NUM_LEDS, 51);
+    if (corrected.estimateCurrent(frame, NUM_LEDS, 255) != 553800 || brightness != 51) {
+        printf("Power model: corrected full white limited to %u, expected 51\n", brightness);
+        errors++;
+    }
+    for (uint8_t i = 0; i < NUM_LEDS; i++) {
+        frame[i] = CRGB(128, 128, 128);
+    }
+    corrected.setWhiteBalance(UncorrectedColor);
+    if (corrected.estimateCurrent(frame, NUM_LEDS, 255) != 149000) {
+        printf("Power model: gamma corrected gray: %u uA, expected 149000 uA\n", corrected.estimateCurrent(frame, NUM_LEDS, 255));
+        errors++;
+    }
+
+    return report("EFLedPowerModel", errors, "cases=10");
+}
+
+/**
+ * @brief Runs the given state for a number of ticks and records the bytes
+ * pushed to the LEDs after every tick
+ *
+ * @param make Creates a new instance of the state
+ * @param globals Globals selecting the mode of the state
+ * @param ticks Number of ticks to run
+ * @param output Mock backend EFLed pushes to
+ * @return Wire bytes of all ticks
+ */
+static std::vector<uint8_t> recordState(
+    const std::function<FSMStatePtr()>& make,
+    std::shared_ptr<FSMGlobals> globals,
+    uint16_t ticks,
+    const EFLedOutputMock& output
+) {
+    std::vector<uint8_t> frames;
+    FSMStatePtr state = make();
+    state->attachGlobals(globals);
+    state->entry();
+    for (uint16_t i = 0; i < ticks; i++) {
+        {
+            EFLedFrameGuard frame(EFLed);
+            state->run();
+        }
+        frames.insert(frames.end(), output.getLastFrame(), output.getLastFrame() + EFLED_TOTAL_NUM * 3);
+    }
+    state->exit();
+    EFLed.clear();
+    return frames;
+}
+
+/**
+ * @brief Renders every animation backed by EFLedFrameCache live and through
+ * the cache and compares each frame pushed to the LEDs. Runs more than two
+ * periods per animation, so wrong periods are detected, and uses more
+ * animations than the cache has slots, so eviction is covered as well.
+ *
+ * @return True, if cached and live frames are identical
+ */
+static bool checkFrameCache() {
+    constexpr uint16_t TICKS = 140;
+    struct CachedPattern {
+        std::function<FSMStatePtr()> make;  //!< Creates the state
+        uint8_t FSMGlobals::* mode_idx;     //!< Global selecting the animation
+        uint8_t mode;                       //!< Animation to run
+        uint8_t FSMGlobals::* param_idx;    //!< Global selecting the hue, or nullptr
+        uint8_t num_params;                 //!< Number of hues
+    };
+    const CachedPattern patterns[] = {
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 0, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 1, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 2, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 3, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 4, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 5, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 6, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 7, nullptr, 1},
+        {[]() { return makeState<AnimateMatrix>(); }, &FSMGlobals::animMatrixIdx, 8, nullptr, 1},
+        {[]() { return makeState<AnimateSnake>(); }, &FSMGlobals::animSnakeAnimationIdx, 0, &FSMGlobals::animSnakeHueIdx, 5},
+        {[]() { return makeState<AnimateSnake>(); }, &FSMGlobals::animSnakeAnimationIdx, 1, &FSMGlobals::animSnakeHueIdx, 5},
+        {[]() { return makeState<AnimateSnake>(); }, &FSMGlobals::animSnakeAnimationIdx, 2, &FSMGlobals::animSnakeHueIdx, 5},
+    };
+
+    // Full brightness without dithering or current limit, so that every
+    // color difference reaches the wire bytes
+    EFLedOutputMock output;
+    EFLedOutput* const previous_output = EFLed.getOutput();
+    EFLed.setOutput(&output);
+    EFLed.init(255);
+    EFLed.setBrightnessPercent(100);
+    EFLed.setDithering(false);
+    EFLed.setCurrentBudget(UINT16_MAX);
+    EFLedFrameCache.clear();
+
+    uint32_t errors = 0;
+    uint32_t frames = 0;
+    for (const CachedPattern& pattern : patterns) {
+        for (uint8_t param = 0; param < pattern.num_params; param++) {
+            std::shared_ptr<FSMGlobals> globals = std::make_shared<FSMGlobals>();
+            globals.get()->*pattern.mode_idx = pattern.mode;
+            if (pattern.param_idx) {
+                globals.get()->*pattern.param_idx = param;
+            }
+
+            EFLedFrameCache.setEnabled(false);
+            const std::vector<uint8_t> live = recordState(pattern.make, globals, TICKS, output);
+            EFLedFrameCache.setEnabled(true);
+            const std::vector<uint8_t> cached = recordState(pattern.make, globals, TICKS, output);
+
+            for (uint16_t tick = 0; tick < TICKS; tick++) {
+                const size_t offset = (size_t) tick * EFLED_TOTAL_NUM * 3;
+                if (memcmp(live.data() + offset, cached.data() + offset, EFLED_TOTAL_NUM * 3) != 0) {
+                    printf("Frame cache: mode=%u param=%u tick=%u differs from live rendering\n", pattern.mode, param, tick);
+                    errors++;
+                }
+                frames++;
+            }
+        }
+    }
+
+    EFLedFrameCache.clear();
+    EFLed.setOutput(previous_output);
+    EFLed.init();
+    EFLed.setBrightnessPercent(40);
+    EFLed.setDithering(true);
+    EFLed.setCurrentBudget(EFLED_POWER_BUDGET_MA_DEFAULT);
+
+    char detail[32];
+    snprintf(detail, sizeof(detail), "frames=%u", frames);
+    return report("EFLedFrameCache", errors, detail);
+}
+
+/**
+ * @brief Renders a frame that encodes its tick and param, for cache checks
+ */
+static void renderTickParam(uint32_t tick, uint32_t param, CRGB* out) {
+    fill_solid(out, EFLED_TOTAL_NUM, CRGB(tick, param, 0));
+}
+
+/**
+ * @brief Fills all slots of EFLedFrameCache and then requests an animation
+ * that can not be cached. The cached animations must survive, and caching
+ * the other one must be tried only once.
+ *
+ * @return True, if no cached animation was evicted or rendered again
+ */
+static bool checkFrameCacheUncacheable() {
+    constexpr uint16_t PERIOD = 4;
+    constexpr uint16_t TICKS = 10;
+    EFLedFrameCacheClass cache;
+    uint32_t errors = 0;
+
+    for (uint32_t param = 0; param < EFLED_FRAME_CACHE_SLOTS; param++) {
+        cache.get(renderTickParam, param, PERIOD, EFLED_TOTAL_NUM, 0);
+    }
+    for (uint16_t tick = 0; tick < TICKS; tick++) {
+        const CRGB* frame = cache.get(renderTickParam, 0xFF, EFLED_FRAME_CACHE_MAX_FRAMES + 1, EFLED_TOTAL_NUM, tick);
+        if (frame[0] != CRGB(tick, 0xFF, 0)) {
+            errors++;
+        }
+    }
+    for (uint32_t param = 0; param < EFLED_FRAME_CACHE_SLOTS; param++) {
+        const CRGB* frame = cache.get(renderTickParam, param, PERIOD, EFLED_TOTAL_NUM, PERIOD + 1);
+        if (frame[0] != CRGB(1, param, 0)) {
+            errors++;
+        }
+    }
+    if (cache.getMissCount() != EFLED_FRAME_CACHE_SLOTS + 1 || cache.getHitCount() != EFLED_FRAME_CACHE_SLOTS) {
+        printf("Frame cache: %u misses and %u hits after an uncacheable animation\n", cache.getMissCount(), cache.getHitCount());
+        errors++;
+    }
+
+    char detail[32];
+    snprintf(detail, sizeof(detail), "misses=%u", cache.getMissCount());
+    return report("EFLedFrameCache full", errors, detail);
+}
+
+/**
+ * @brief Reference for EFLedRingView: the rotate/blend code DisplayPrideFlag
+ * used to animate the dragon before the ring view. Rotates a copy of the
+ * palette, copies the current and the next window, blends and fades them.
+ *
+ * @param palette Colors to rotate
+ * @param len Number of colors. Must be larger than num.
+ * @param idx Index of the first color to show
+ * @param frac Blend amount towards the next window
+ * @param fade Amount to fade the output by
+ * @param out Destination to render into
+ * @param num Number of LEDs to render
+ */
+static void referenceRotateBlend(
+    const CRGB* palette,
+    uint8_t len,
+    uint32_t idx,
+    uint8_t frac,
+    uint8_t fade,
+    CRGB* out,
+    uint8_t num
+) {
+    std::vector<CRGB> rotated(palette, palette + len);
+    std::rotate(rotated.begin(), rotated.begin() + idx % len, rotated.end());
+
+    std::vector<CRGB> current(rotated.begin(), rotated.begin() + num);
+    std::vector<CRGB> next(rotated.begin() + 1, rotated.begin() + 1 + num);
+    blend(current.data(), next.data(), out, num, frac);
+    fadeLightBy(out, num, fade);
+}
+
+/**
+ * @brief Compares EFLedRingView::render() and the dragon track of
+ * EFLedTimelinePlayer with the former rotate/blend code over all offsets,
+ * several blend factors and fades
+ *
+ * @return True, if all rendered bytes are identical
+ */
+static bool checkRingView() {
+    const CRGB* palettes[] = {EFPrideFlags::LGBT, EFPrideFlags::Bisexual, EFPrideFlags::Intersex};
+    const uint8_t fracs[] = {0, 1, 12, 127, 128, 191, 254, 255};
+    const uint8_t fades[] = {0, 1, 128, 255};
+    const uint8_t nums[] = {1, EFLED_DRAGON_NUM, EFLED_EFBAR_NUM - 1};
+    CRGB expected[EFLED_TOTAL_NUM];
+    CRGB actual[EFLED_TOTAL_NUM];
+    uint32_t errors = 0;
+    uint32_t cases = 0;
+
+    for (const CRGB* palette : palettes) {
+        const EFLedRingView view(palette, EFLED_EFBAR_NUM);
+        for (uint32_t idx = 0; idx < 2 * EFLED_EFBAR_NUM; idx++) {
+            for (uint8_t frac : fracs) {
+                for (uint8_t fade : fades) {
+                    for (uint8_t num : nums) {
+                        referenceRotateBlend(palette, EFLED_EFBAR_NUM, idx, frac, fade, expected, num);
+                        view.render(EFLedRingView::position(idx, frac), actual, num, fade);
+                        if (memcmp(expected, actual, num * sizeof(CRGB)) != 0) {
+                            printf("Ring view: idx=%u frac=%u fade=%u num=%u differs from rotate/blend\n", idx, frac, fade, num);
+                            errors++;
+                        }
+                        cases++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Dragon of DisplayPrideFlag: one flag entry per 20 ticks of 20 ms, blended over the step
+    const EFLedTrack track = {EFLED_REGION_DRAGON, 400, 0, 128, EFLED_TRACK_BLEND};
+    const EFLedKeyframe keyframe = {0, EFPrideFlags::LGBT, EFLED_EFBAR_NUM};
+    const EFLedTimeline timeline = {&track, 1, &keyframe, 1, 0};
+    for (uint32_t tick = 0; tick < 2 * EFLED_EFBAR_NUM * 20; tick++) {
+        const uint8_t frac = ((tick % 20) / 20.0) * 255;
+        referenceRotateBlend(EFPrideFlags::LGBT, EFLED_EFBAR_NUM, tick / 20, frac, 128, expected, EFLED_DRAGON_NUM);
+        EFLedTimelinePlayer::render(timeline, tick * 20, 0, actual);
+        if (memcmp(expected, actual + EFLED_DARGON_OFFSET, EFLED_DRAGON_NUM * sizeof(CRGB)) != 0) {
+            printf("Timeline player: tick=%u differs from rotate/blend\n", tick);
+            errors++;
+        }
+        cases++;
+    }
+
+    char detail[32];
+    snprintf(detail, sizeof(detail), "cases=%u", cases);
+    return report("EFLedRingView", errors, detail);
+}
+
+/**
+ * @brief Decodes the animation image written by tools/efanim.py, see
+ * gen_animation_fixture.py, and compares every frame with its source. Plays
+ * each animation twice to cover the wrap around to the first frame.
+ *
+ * @return True, if all animations were found and decoded to their source frames
+ */
+static bool checkAnimation() {
+    constexpr uint8_t NUM_FIXTURES = sizeof(ANIMATION_FIXTURES) / sizeof(ANIMATION_FIXTURES[0]);
+    static_assert(sizeof(CRGB) == 3, "Frames are compared as RGB bytes");
+    EFLedAnimationStoreClass store;
+    EFLedAnimation animation;
+    CRGB frame[UINT8_MAX];
+    uint32_t errors = 0;
+    uint32_t frames = 0;
+
+    store.begin(ANIMATION_FIXTURE_IMAGE, sizeof(ANIMATION_FIXTURE_IMAGE));
+    if (store.count() != NUM_FIXTURES) {
+        printf("Animation: found %u animations, expected %u\n", store.count(), NUM_FIXTURES);
+        errors++;
+    }
+
+    for (uint16_t idx = 0; idx < store.count() && idx < NUM_FIXTURES; idx++) {
+        const AnimationFixture& fixture = ANIMATION_FIXTURES[idx];
+        if (
+            !store.open(idx, animation) ||
+            strncmp(animation.getName(), fixture.name, sizeof(EFLedAnimationHeader::name)) != 0 ||
+            animation.getFrameMs() != fixture.frame_ms ||
+            animation.getNumLeds() != fixture.num_leds ||
+            animation.getNumFrames() != fixture.num_frames
+        ) {
+            printf("Animation: header of %s does not match its source\n", fixture.name);
+            errors++;
+            continue;
+        }
+
+        fill_solid(frame, fixture.num_leds, CRGB::Black);
+        for (uint32_t i = 0; i < 2 * fixture.num_frames; i++) {
+            const uint8_t* expected = fixture.frames + (i % fixture.num_frames) * fixture.num_leds * 3;
+            if (!animation.nextFrame(frame) || memcmp(frame, expected, fixture.num_leds * 3) != 0) {
+                printf("Animation: frame %u of %s differs from its source\n", i, fixture.name);
+                errors++;
+            }
+            frames++;
+        }
+    }
+
+    char detail[32];
+    snprintf(detail, sizeof(detail), "frames=%u", frames);
+    return report("EFLedAnimation", errors, detail);
+}
+
+/**
+ * @brief Selects more accounts in EFEnergyClass than it has slots. Charge of
+ * accounts that did not fit must end up in EFENERGY_OTHER_ACCOUNT, while
+ * known accounts keep being charged.
+ *
+ * @return True, if charge was attributed as expected
+ */
+static bool checkEnergyAccounts() {
+    constexpr uint8_t NUM_STATES = EFENERGY_MAX_ACCOUNTS + 4;
+    constexpr uint32_t TICK_MS = 10;
+    EFEnergyClass energy;
+    char name[EFENERGY_NAME_LEN];
+    uint32_t errors = 0;
+
+    energy.begin();
+    for (uint8_t i = 0; i < NUM_STATES; i++) {
+        snprintf(name, sizeof(name), "State%u", i);
+        energy.setAccount(name);
+        delay(TICK_MS);
+        energy.update(0);
+    }
+    energy.setAccount("State0");
+    delay(TICK_MS);
+    energy.update(0);
+
+    // All but the last slot hold states, the last one everything else
+    const EFEnergyAccount& other = energy.getAccount(EFENERGY_MAX_ACCOUNTS - 1);
+    if (energy.getAccountCount() != EFENERGY_MAX_ACCOUNTS || strcmp(other.name, EFENERGY_OTHER_ACCOUNT) != 0) {
+        printf("Energy: %u accounts, last one is %s\n", energy.getAccountCount(), other.name);
+        errors++;
+    }
+    // delay() advances the host clock, which keeps running in real time as well
+    constexpr uint32_t OTHER_MS = (NUM_STATES - EFENERGY_MAX_ACCOUNTS + 1) * TICK_MS;
+    if (other.active_ms < OTHER_MS || other.active_ms >= OTHER_MS + TICK_MS || other.charge_uams == 0) {
+        printf("Energy: other account was active for %u ms\n", other.active_ms);
+        errors++;
+    }
+    if (energy.getAccount(0).active_ms < 2 * TICK_MS || energy.getAccount(0).active_ms >= 3 * TICK_MS || energy.getChargeMah("State16") != 0) {
+        printf("Energy: charge attributed to the wrong account\n");
+        errors++;
+    }
+
+    char detail[32];
+    snprintf(detail, sizeof(detail), "accounts=%u", energy.getAccountCount());
+    return report("EFEnergy accounts", errors, detail);
+}
+
+bool runChecks() {
+    bool ok = true;
+    ok = checkOutputFence() && ok;
+    ok = checkForcedRefresh() && ok;
+    ok = checkCompositorReplace() && ok;
+    ok = checkPowerModel() && ok;
+    ok = checkFrameCache() && ok;
+    ok = checkFrameCacheUncacheable() && ok;
+    ok = checkRingView() && ok;
+    ok = checkAnimation() && ok;
+    ok = checkEnergyAccounts() && ok;
+    return ok;
+}
@@ -0,0 +1,163 @@
+#!/usr/bin/python3
+
+# MIT License
+#
+# Copyright 2024 Eurofurence e.V.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the “Software”),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+
+# Generates native/bench/animation_fixture.h for the EFLedAnimation host
+# check (see native/bench/checks.cpp). Builds a few animations that cover all
+# opcodes and run splitting, encodes them with tools/efanim.py and writes the
+# resulting partition image together with the source frames into a header.
+#
+# Usage:
+#   native/bench/gen_animation_fixture.py
+
+import json
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")
+EFANIM = os.path.join(ROOT, "tools", "efanim.py")
+OUTPUT = os.path.join(ROOT, "native", "bench", "animation_fixture.h")
+
+
+def sparkle(rng):
+    """Sparse changes on the badge LEDs: skips and short literals."""
+    frame = [(0, 0, 0)] * 17
+    frames = []
+    for _ in range(40):
+        frame = list(frame)
+        for _ in range(rng.randint(0, 4)):
+            frame[rng.randrange(17)] = (rng.randrange(256), rng.randrange(256), rng.randrange(256))
+        frames.append(frame)
+    return {"name": "Sparkle", "frame_ms": 50, "frames": frames}
+
+
+def wipe():
+    """Color wipe across the badge LEDs: fills next to changed LEDs."""
+    colors = [(255, 0, 0), (0, 255, 0), (0, 0, 255), (255, 255, 255)]
+    frames = []
+    for color in colors:
+        for i in range(1, 18):
+            frames.append([color] * i + [(0, 0, 0)] * (17 - i))
+    return {"name": "Wipe", "frame_ms": 20, "frames": frames}
+
+
+def long_strip():
+    """Strip longer than a single run: fill, literal and skip runs are split."""
+    num = 150
+    gradient = [(i, 255 - i, (i * 7) % 256) for i in range(num)]
+    frames = [
+        [(10, 20, 30)] * num,
+        gradient,
+        gradient,
+        [(10, 20, 30)] * 70 + gradient[70:],
+        [(0, 0, 0)] * num,
+    ]
+    return {"name": "Long strip name", "frame_ms": 100, "frames": frames}
+
+
+def c_bytes(data, indent="    "):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append(indent + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    rng = random.Random(28)
+    animations = [sparkle(rng), wipe(), long_strip()]
+
+    with tempfile.TemporaryDirectory() as tmp:
+        inputs = []
+        for idx, animation in enumerate(animations):
+            path = os.path.join(tmp, "%d.json" % idx)
+            with open(path, "w") as f:
+                json.dump({
+                    "name": animation["name"],
+                    "frame_ms": animation["frame_ms"],
+                    "frames": [["#%02x%02x%02x" % c for c in frame] for frame in animation["frames"]],
+                }, f)
+            inputs.append(path)
+        image_path = os.path.join(tmp, "anim.bin")
+        subprocess.run([sys.executable, EFANIM, "-o", image_path] + inputs, check=True, stdout=subprocess.DEVNULL)
+        with open(image_path, "rb") as f:
+            image = f.read()
+
+    with open(__file__) as f:
+        license = "".join("//" + line[1:] for line in f.readlines()[2:23])
+
+    out = [license.rstrip("\n"), ""]
+    out.append("// Generated by native/bench/gen_animation_fixture.py with tools/efanim.py. Do not edit.")
+    out.append("")
+    out.append("#ifndef NATIVE_BENCH_ANIMATION_FIXTURE_H_")
+    out.append("#define NATIVE_BENCH_ANIMATION_FIXTURE_H_")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief Animation partition image written by tools/efanim.py")
+    out.append(" */")
+    out.append("alignas(4) static const uint8_t ANIMATION_FIXTURE_IMAGE[] = {")
+    out.append(c_bytes(image))
+    out.append("};")
+    for idx, animation in enumerate(animations):
+        frames = animation["frames"]
+        out.append("")
+        out.append("/**")
+        out.append(" * @brief Source frames of \"%s\", RGB" % animation["name"])
+        out.append(" */")
+        out.append("static const uint8_t ANIMATION_FIXTURE_FRAMES_%d[] = {" % idx)
+        out.append(c_bytes(bytes(c for frame in frames for color in frame for c in color)))
+        out.append("};")
+    out.append("")
+    out.append("/**")
+    out.append(" * @brief Source of an animation inside ANIMATION_FIXTURE_IMAGE")
+    out.append(" */")
+    out.append("struct AnimationFixture {")
+    out.append("    const char* name;       //!< Name of the animation")
+    out.append("    uint16_t frame_ms;      //!< Duration of a single frame")
+    out.append("    uint8_t num_leds;       //!< Number of LEDs per frame")
+    out.append("    uint16_t num_frames;    //!< Number of frames")
+    out.append("    const uint8_t* frames;  //!< All frames, RGB")
+    out.append("};")
+    out.append("")
+    out.append("static const AnimationFixture ANIMATION_FIXTURES[] = {")
+    for idx, animation in enumerate(animations):
+        out.append("    {\"%s\", %d, %d, %d, ANIMATION_FIXTURE_FRAMES_%d}," % (
+            animation["name"], animation["frame_ms"], len(animation["frames"][0]), len(animation["frames"]), idx
+        ))
+    out.append("};")
+    out.append("")
+    out.append("#endif /* NATIVE_BENCH_ANIMATION_FIXTURE_H_ */")
+
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,116 @@
+#ifndef ARDUINO_H_
+#define ARDUINO_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+/**
+ * @brief Minimal stand-in for the Arduino core, used by the native environment.
+ * Only covers what the LED and animation stack needs.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+using std::max;
+using std::min;
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT  0x01
+#define OUTPUT 0x03
+
+#define ARDUINO_ISR_ATTR
+#define IRAM_ATTR
+#define RTC_DATA_ATTR
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+/**
+ * @brief Time since start. delay() advances time without sleeping.
+ */
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+void analogReadResolution(uint8_t bits);
+/**
+ * @brief Returns pseudo-random noise
+ */
+uint16_t analogRead(uint8_t pin);
+
+void noInterrupts();
+void interrupts();
+
+uint32_t getCpuFrequencyMhz();
+bool setCpuFrequencyMhz(uint32_t cpu_freq_mhz);
+
+class String {
+    public:
+        String() = default;
+        String(const char* str) : data(str ? str : "") {}
+        String(const std::string& str) : data(str) {}
+        const char* c_str() const { return data.c_str(); }
+        unsigned int length() const { return data.length(); }
+        bool operator==(const String& other) const { return data == other.data; }
+
+    private:
+        std::string data;
+};
+
+/**
+ * @brief Serial port writing to stdout
+ */
+class HostSerial {
+    public:
+        void begin(unsigned long baud) { (void) baud; }
+        size_t print(const char* msg) { return std::fputs(msg, stdout) >= 0 ? std::strlen(msg) : 0; }
+        size_t println(const char* msg) { size_t n = this->print(msg); return n + this->print("\r\n"); }
+        size_t println(const String& msg) { return this->println(msg.c_str()); }
+        size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+        operator bool() const { return true; }
+};
+
+extern HostSerial Serial;
+extern HostSerial USBSerial;
+
+#endif /* ARDUINO_H_ */
@@ -0,0 +1,191 @@
+#ifndef FASTLED_H_
+#define FASTLED_H_
+
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+/**
+ * @brief Minimal stand-in for FastLED, used by the native environment. The
+ * integer math matches FastLED, so that rendered frames are identical.
+ */
+
+#include <cstdint>
+
+typedef uint8_t fract8;
+typedef uint16_t fract16;
+
+// Integer math as implemented by lib8tion with FASTLED_SCALE8_FIXED=1
+inline uint8_t scale8(uint8_t i, fract8 scale) {
+    return (uint8_t) (((uint16_t) i * (1 + (uint16_t) scale)) >> 8);
+}
+
+inline uint8_t scale8_video(uint8_t i, fract8 scale) {
+    return (uint8_t) ((((uint16_t) i * scale) >> 8) + ((i && scale) ? 1 : 0));
+}
+
+inline uint16_t scale16(uint16_t i, fract16 scale) {
+    return (uint16_t) (((uint32_t) i * (1 + (uint32_t) scale)) >> 16);
+}
+
+inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    unsigned int t = i + j;
+    return t > 255 ? 255 : t;
+}
+
+inline uint8_t qsub8(uint8_t i, uint8_t j) {
+    int t = i - j;
+    return t < 0 ? 0 : t;
+}
+
+inline uint8_t blend8(uint8_t a, uint8_t b, uint8_t amountOfB) {
+    uint16_t partial = (a << 8) | b;
+    partial += (b * amountOfB);
+    partial -= (a * amountOfB);
+    return partial >> 8;
+}
+
+inline uint8_t lerp8by8(uint8_t a, uint8_t b, fract8 frac) {
+    return blend8(a, b, frac);
+}
+
+struct CHSV {
+    union {
+        struct {
+            union { uint8_t hue; uint8_t h; };
+            union { uint8_t saturation; uint8_t sat; uint8_t s; };
+            union { uint8_t value; uint8_t val; uint8_t v; };
+        };
+        uint8_t raw[3];
+    };
+
+    CHSV() : h(0), s(0), v(0) {}
+    constexpr CHSV(uint8_t ih, uint8_t is, uint8_t iv) : h(ih), s(is), v(iv) {}
+};
+
+typedef enum {
+    TypicalSMD5050 = 0xFFB0F0,
+    TypicalLEDStrip = 0xFFB0F0,
+    Typical8mmPixel = 0xFFE08C,
+    UncorrectedColor = 0xFFFFFF,
+} LEDColorCorrection;
+
+struct CRGB;
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb);
+
+struct CRGB {
+    union {
+        struct {
+            union { uint8_t r; uint8_t red; };
+            union { uint8_t g; uint8_t green; };
+            union { uint8_t b; uint8_t blue; };
+        };
+        uint8_t raw[3];
+    };
+
+    typedef enum {
+        Black = 0x000000,
+        Blue = 0x0000FF,
+        DarkBlue = 0x00008B,
+        Green = 0x008000,
+        Orange = 0xFFA500,
+        Purple = 0x800080,
+        Red = 0xFF0000,
+        Silver = 0xC0C0C0,
+        White = 0xFFFFFF,
+        Yellow = 0xFFFF00,
+    } HTMLColorCode;
+
+    CRGB() = default;
+    constexpr CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    constexpr CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+    constexpr CRGB(HTMLColorCode colorcode) : CRGB((uint32_t) colorcode) {}
+    CRGB(const CHSV& rhs) { hsv2rgb_rainbow(rhs, *this); }
+
+    CRGB& operator=(const CHSV& rhs) { hsv2rgb_rainbow(rhs, *this); return *this; }
+    CRGB& operator=(uint32_t colorcode) { *this = CRGB(colorcode); return *this; }
+
+    uint8_t& operator[](uint8_t x) { return raw[x]; }
+    const uint8_t& operator[](uint8_t x) const { return raw[x]; }
+
+    CRGB& operator+=(const CRGB& rhs) { r = qadd8(r, rhs.r); g = qadd8(g, rhs.g); b = qadd8(b, rhs.b); return *this; }
+    CRGB& operator-=(const CRGB& rhs) { r = qsub8(r, rhs.r); g = qsub8(g, rhs.g); b = qsub8(b, rhs.b); return *this; }
+
+    CRGB& nscale8(uint8_t scaledown) { r = ::scale8(r, scaledown); g = ::scale8(g, scaledown); b = ::scale8(b, scaledown); return *this; }
+    CRGB& nscale8_video(uint8_t scaledown) { r = ::scale8_video(r, scaledown); g = ::scale8_video(g, scaledown); b = ::scale8_video(b, scaledown); return *this; }
+    CRGB& fadeLightBy(uint8_t fadefactor) { return nscale8_video(255 - fadefactor); }
+    CRGB& fadeToBlackBy(uint8_t fadefactor) { return nscale8(255 - fadefactor); }
+    CRGB scale8(uint8_t scaledown) const { CRGB out = *this; out.nscale8(scaledown); return out; }
+
+    uint8_t getLuma() const { return ::scale8(r, 54) + ::scale8(g, 183) + ::scale8(b, 18); }
+
+    explicit operator bool() const { return r || g || b; }
+};
+
+inline bool operator==(const CRGB& lhs, const CRGB& rhs) { return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b; }
+inline bool operator!=(const CRGB& lhs, const CRGB& rhs) { return !(lhs == rhs); }
+inline CRGB operator+(const CRGB& p1, const CRGB& p2) { CRGB out = p1; out += p2; return out; }
+
+CRGB blend(const CRGB& p1, const CRGB& p2, fract8 amountOfP2);
+CRGB* blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amountOfsrc2);
+CHSV blend(const CHSV& p1, const CHSV& p2, fract8 amountOfP2);
+void fill_solid(CRGB* targetArray, int numToFill, const CRGB& color);
+void fill_rainbow(CRGB* targetArray, int numToFill, uint8_t initialhue, uint8_t deltahue = 5);
+void fill_rainbow_circular(CRGB* targetArray, int numToFill, uint8_t initialhue, bool reversed = false);
+void fadeLightBy(CRGB* leds, uint16_t num_leds, uint8_t fadeBy);
+void fadeToBlackBy(CRGB* leds, uint16_t num_leds, uint8_t fadeBy);
+void nscale8(CRGB* leds, uint16_t num_leds, uint8_t scale);
+void nscale8_video(CRGB* leds, uint16_t num_leds, uint8_t scale);
+
+enum ESPIChipsets { WS2812B };
+enum EOrder { RGB = 0012, GRB = 0102 };
+
+#define DISABLE_DITHER 0x00
+#define BINARY_DITHER 0x01
+
+/**
+ * @brief Minimal stand-in for the FastLED controller. show() only counts the
+ * frames that would have been pushed to the strip.
+ */
+class CFastLED {
+    public:
+        template<ESPIChipsets CHIPSET, uint8_t DATA_PIN, EOrder RGB_ORDER>
+        void addLeds(CRGB* data, int num_leds) {
+            this->leds = data;
+            this->num_leds = num_leds;
+        }
+
+        void show() { this->num_shows++; }
+        void clear(bool writeData = false) { this->clearData(); if (writeData) { this->show(); } }
+        void clearData() { if (this->leds) { fill_solid(this->leds, this->num_leds, CRGB::Black); } }
+        void setBrightness(uint8_t scale) { this->brightness = scale; }
+        uint8_t getBrightness() const { return this->brightness; }
+        void setDither(uint8_t ditherMode) { (void) ditherMode; }
+
+        CRGB* leds = nullptr;
+        int num_leds = 0;
+        uint8_t brightness = 255;
+        unsigned long num_shows = 0;
+};
+
+extern CFastLED FastLED;
+
+#endif /* FASTLED_H_ */
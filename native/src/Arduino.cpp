@@ -0,0 +1,102 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <chrono>
+#include <random>
+
+#include <Arduino.h>
+
+HostSerial Serial;
+HostSerial USBSerial;
+
+static const auto host_boot = std::chrono::steady_clock::now();
+static uint64_t host_skew_us = 0;  // Time skipped by delay() without sleeping
+static std::mt19937 host_rng(42);
+static uint32_t host_cpu_freq_mhz = 80;
+
+size_t HostSerial::printf(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    int n = std::vprintf(format, args);
+    va_end(args);
+    return n < 0 ? 0 : n;
+}
+
+unsigned long micros() {
+    auto elapsed = std::chrono::steady_clock::now() - host_boot;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() + host_skew_us;
+}
+
+unsigned long millis() {
+    return micros() / 1000;
+}
+
+void delay(uint32_t ms) {
+    host_skew_us += ms * 1000ULL;
+}
+
+void delayMicroseconds(uint32_t us) {
+    host_skew_us += us;
+}
+
+void yield() {}
+
+long random(long max) {
+    return random(0, max);
+}
+
+long random(long min, long max) {
+    if (min >= max) {
+        return min;
+    }
+    return min + (long) (host_rng() % (unsigned long) (max - min));
+}
+
+void randomSeed(unsigned long seed) {
+    host_rng.seed(seed);
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+    const long run = in_max - in_min;
+    if (run == 0) {
+        return out_min;
+    }
+    return (x - in_min) * (out_max - out_min) / run + out_min;
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {}
+void digitalWrite(uint8_t pin, uint8_t val) {}
+int digitalRead(uint8_t pin) { return LOW; }
+void analogReadResolution(uint8_t bits) {}
+uint16_t analogRead(uint8_t pin) { return (uint16_t) random(0, 4096); }
+
+void noInterrupts() {}
+void interrupts() {}
+
+uint32_t getCpuFrequencyMhz() {
+    return host_cpu_freq_mhz;
+}
+
+bool setCpuFrequencyMhz(uint32_t cpu_freq_mhz) {
+    host_cpu_freq_mhz = cpu_freq_mhz;
+    return true;
+}
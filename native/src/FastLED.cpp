@@ -0,0 +1,170 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <FastLED.h>
+
+CFastLED FastLED;
+
+void hsv2rgb_rainbow(const CHSV& hsv, CRGB& rgb) {
+    const uint8_t hue = hsv.hue;
+    const uint8_t sat = hsv.sat;
+    uint8_t val = hsv.val;
+
+    const uint8_t offset8 = (hue & 0x1F) << 3;
+    const uint8_t third = scale8(offset8, (256 / 3));
+    uint8_t r, g, b;
+
+    if (!(hue & 0x80)) {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) {
+                r = 255 - third; g = third; b = 0;
+            } else {
+                r = 171; g = 85 + third; b = 0;
+            }
+        } else {
+            if (!(hue & 0x20)) {
+                uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+                r = 171 - twothirds; g = 170 + third; b = 0;
+            } else {
+                r = 0; g = 255 - third; b = third;
+            }
+        }
+    } else {
+        if (!(hue & 0x40)) {
+            if (!(hue & 0x20)) {
+                uint8_t twothirds = scale8(offset8, ((256 * 2) / 3));
+                r = 0; g = 171 - twothirds; b = 85 + twothirds;
+            } else {
+                r = third; g = 0; b = 255 - third;
+            }
+        } else {
+            if (!(hue & 0x20)) {
+                r = 85 + third; g = 0; b = 171 - third;
+            } else {
+                r = 170 + third; g = 0; b = 85 - third;
+            }
+        }
+    }
+
+    if (sat != 255) {
+        if (sat == 0) {
+            r = 255; g = 255; b = 255;
+        } else {
+            uint8_t desat = 255 - sat;
+            desat = scale8_video(desat, desat);
+            uint8_t satscale = 255 - desat;
+            if (r) r = scale8(r, satscale) + 1;
+            if (g) g = scale8(g, satscale) + 1;
+            if (b) b = scale8(b, satscale) + 1;
+            r += desat; g += desat; b += desat;
+        }
+    }
+
+    if (val != 255) {
+        val = scale8_video(val, val);
+        if (val == 0) {
+            r = 0; g = 0; b = 0;
+        } else {
+            if (r) r = scale8(r, val) + 1;
+            if (g) g = scale8(g, val) + 1;
+            if (b) b = scale8(b, val) + 1;
+        }
+    }
+
+    rgb.r = r;
+    rgb.g = g;
+    rgb.b = b;
+}
+
+CRGB blend(const CRGB& p1, const CRGB& p2, fract8 amountOfP2) {
+    if (amountOfP2 == 0) {
+        return p1;
+    }
+    if (amountOfP2 == 255) {
+        return p2;
+    }
+    return CRGB(blend8(p1.r, p2.r, amountOfP2), blend8(p1.g, p2.g, amountOfP2), blend8(p1.b, p2.b, amountOfP2));
+}
+
+CRGB* blend(const CRGB* src1, const CRGB* src2, CRGB* dest, uint16_t count, fract8 amountOfsrc2) {
+    for (uint16_t i = 0; i < count; i++) {
+        dest[i] = blend(src1[i], src2[i], amountOfsrc2);
+    }
+    return dest;
+}
+
+CHSV blend(const CHSV& p1, const CHSV& p2, fract8 amountOfP2) {
+    return CHSV(blend8(p1.h, p2.h, amountOfP2), blend8(p1.s, p2.s, amountOfP2), blend8(p1.v, p2.v, amountOfP2));
+}
+
+void fill_solid(CRGB* targetArray, int numToFill, const CRGB& color) {
+    for (int i = 0; i < numToFill; i++) {
+        targetArray[i] = color;
+    }
+}
+
+void fill_rainbow(CRGB* targetArray, int numToFill, uint8_t initialhue, uint8_t deltahue) {
+    CHSV hsv(initialhue, 240, 255);
+    for (int i = 0; i < numToFill; i++) {
+        targetArray[i] = hsv;
+        hsv.hue += deltahue;
+    }
+}
+
+void fill_rainbow_circular(CRGB* targetArray, int numToFill, uint8_t initialhue, bool reversed) {
+    if (numToFill == 0) {
+        return;
+    }
+
+    const uint16_t hueChange = 65535 / (uint16_t) numToFill;
+    uint16_t hueOffset = 0;
+    CHSV hsv(initialhue, 240, 255);
+    for (int i = 0; i < numToFill; i++) {
+        targetArray[i] = hsv;
+        if (reversed) {
+            hueOffset -= hueChange;
+        } else {
+            hueOffset += hueChange;
+        }
+        hsv.hue = initialhue + (uint8_t) (hueOffset >> 8);
+    }
+}
+
+void nscale8(CRGB* leds, uint16_t num_leds, uint8_t scale) {
+    for (uint16_t i = 0; i < num_leds; i++) {
+        leds[i].nscale8(scale);
+    }
+}
+
+void nscale8_video(CRGB* leds, uint16_t num_leds, uint8_t scale) {
+    for (uint16_t i = 0; i < num_leds; i++) {
+        leds[i].nscale8_video(scale);
+    }
+}
+
+void fadeLightBy(CRGB* leds, uint16_t num_leds, uint8_t fadeBy) {
+    nscale8_video(leds, num_leds, 255 - fadeBy);
+}
+
+void fadeToBlackBy(CRGB* leds, uint16_t num_leds, uint8_t fadeBy) {
+    nscale8(leds, num_leds, 255 - fadeBy);
+}
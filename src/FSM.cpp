@@ -26,11 +26,16 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include <assert.h>
 
+#include <EFEnergy.h>
+#include <EFHeap.h>
 #include <EFLed.h>
+#include <EFLedEffects.h>
 #include <EFLogging.h>
 
 #include "FSM.h"
+#include "util.h"
 
 Preferences pref;
 
@@ -38,9 +43,19 @@ FSM::FSM(unsigned int tickrate_ms)
 : state(nullptr)
 , tickrate_ms(tickrate_ms)
 , state_last_run(0)
+, tick_show_count(0)
+, tick_show_count_max(0)
+, state_interval_ms(0)
+, frames_saved(0)
+, frames_saved_window_start(0)
+, frames_saved_window_start_ms(0)
+, frames_saved_per_minute(0)
+, events_dropped_reported(0)
+, latency_pending_num(0)
+, job_persist(EFSCHEDULER_INVALID_JOB)
 {
     this->globals = std::make_shared<FSMGlobals>();
-    this->state = std::make_unique<DisplayPrideFlag>();
+    this->state = makeState<DisplayPrideFlag>();
     this->state->attachGlobals(this->globals);
 }
 
@@ -51,35 +66,42 @@ FSM::~FSM() {
 void FSM::resume() {
     // Restore FSM data
     this->restoreGlobals();
+    if (this->job_persist == EFSCHEDULER_INVALID_JOB) {
+        this->job_persist = EFScheduler.add("fsm_persist", [](void* ctx) {
+            ((FSM*) ctx)->persistGlobals();
+        }, this);
+    }
 
     // Restore LED brightness setting
     EFLed.setBrightnessPercent(this->globals->ledBrightnessPercent);
     
     // Resume last remembered state
     switch (this->globals->resumeStateIdx) {
-        case 0: this->transition(std::make_unique<DisplayPrideFlag>()); break;
-        case 1: this->transition(std::make_unique<AnimateRainbow>()); break;
-        case 2: this->transition(std::make_unique<AnimateMatrix>()); break;
-        case 3: this->transition(std::make_unique<AnimateSnake>()); break;
-        case 4: this->transition(std::make_unique<AnimateHeartbeat>()); break;
-		case 6: this->transition(std::make_unique<GameHuemesh>()); break;
-		case 7: this->transition(std::make_unique<VUMeter>()); break;
-        case 8: this->transition(std::make_unique<CustomPatternsDisplay>()); break;
+        case 0: this->transition(makeState<DisplayPrideFlag>()); break;
+        case 1: this->transition(makeState<AnimateRainbow>()); break;
+        case 2: this->transition(makeState<AnimateMatrix>()); break;
+        case 3: this->transition(makeState<AnimateSnake>()); break;
+        case 4: this->transition(makeState<AnimateHeartbeat>()); break;
+		case 6: this->transition(makeState<GameHuemesh>()); break;
+		case 7: this->transition(makeState<VUMeter>()); break;
+        case 8: this->transition(makeState<CustomPatternsDisplay>()); break;
+        case 9: this->transition(makeState<AnimationPlayback>()); break;
         default:
             LOGF_WARNING("(FSM) Failed to resume to unknown state: %d\r\n", this->globals->resumeStateIdx);
-            this->transition(std::make_unique<DisplayPrideFlag>());
+            this->transition(makeState<DisplayPrideFlag>());
             break;
 
     }
 }
 
-void FSM::transition(std::unique_ptr<FSMState> next) {
+void FSM::transition(FSMStatePtr next) {
     if (next == nullptr) {
         LOG_WARNING("(FSM) Failed to transition to null state. Aborting.");
         return;
     }
 
     // State exit
+    const uint32_t start_us = micros();
     LOGF_INFO("(FSM) Transition %s -> %s\r\n", this->state->getName(), next->getName());
     this->state->exit();
 
@@ -96,47 +118,79 @@ void FSM::transition(std::unique_ptr<FSMState> next) {
     this->state = std::move(next);
     this->state->attachGlobals(this->globals);
     this->state_last_run = 0;
+    this->state_interval_ms = 0;
+    EFEnergy.setAccount(this->state->getName());
     this->state->entry();
+    LOGF_DEBUG("(FSM) Transition took %lu us\r\n", (unsigned long) (micros() - start_us));
 }
 
 unsigned int FSM::getTickRateMs() {
     return this->tickrate_ms;
 }
 
-void FSM::queueEvent(FSMEvent event) {
-    FSMEvent test = std::move(event);
-    noInterrupts();
-    {
-        this->eventqueue.push(test);
+unsigned int FSM::getMsUntilNextRun() {
+    // Feedback effects and states without own tick rate advance every cycle
+    if (EFLedEffects.isActive() || this->state->getTickRateMs() == 0) {
+        return this->tickrate_ms;
     }
-    interrupts();
+
+    const unsigned int elapsed = millis() - this->state_last_run;
+    if (elapsed >= this->state_interval_ms) {
+        return 0;
+    }
+    return this->state_interval_ms - elapsed;
+}
+
+void FSM::queueEvent(FSMEvent event) {
+    this->queueEvent(event, micros());
+}
+
+void FSM::queueEvent(FSMEvent event, uint32_t timestamp_us) {
+    this->eventqueue.push(event, timestamp_us);
 }
 
 unsigned int FSM::getQueueSize() {
-    unsigned int queuesize;
+    return this->eventqueue.size();
+}
 
-    noInterrupts();
-    {
-        queuesize = this->eventqueue.size();
-    }
-    interrupts();
+uint32_t FSM::getDroppedEventCount() {
+    return this->eventqueue.getDroppedCount();
+}
 
-    return queuesize;
+uint32_t FSM::getEventOverflowCount() {
+    return this->eventqueue.getOverflowCount();
 }
 
-FSMEvent FSM::dequeueEvent() {
-    FSMEvent event = FSMEvent::NoOp;
+FSMTimedEvent FSM::dequeueEvent() {
+    FSMTimedEvent timed;
+    if (!this->eventqueue.pop(timed)) {
+        return {FSMEvent::NoOp, (uint32_t) micros()};
+    }
+    return timed;
+}
 
-    noInterrupts();
-    {
-        if (this->eventqueue.size() > 0) {
-            event = std::move(this->eventqueue.front());
-            this->eventqueue.pop();
-        }
+void FSM::trackPhotonLatency() {
+    const EFLedOutput* output = EFLed.getOutput();
+    if (output == nullptr) {
+        this->latency_pending_num = 0;
+        return;
     }
-    interrupts();
 
-    return event;
+    const uint32_t completed = output->getCompletedFrameCount();
+    const uint32_t now_us = micros();
+    uint8_t kept = 0;
+    for (uint8_t i = 0; i < this->latency_pending_num; i++) {
+        const FSMPendingPhoton& pending = this->latency_pending[i];
+        if ((int32_t) (completed - pending.frames_submitted) > 0) {
+            // A frame submitted after the event was dequeued has been sent
+            this->latency[(uint8_t) pending.event][(uint8_t) FSMLatencyStage::Photon].record(
+                output->getLastCompleteMicros() - pending.raised_us
+            );
+        } else if (now_us - pending.raised_us < FSM_LATENCY_PHOTON_TIMEOUT_US) {
+            this->latency_pending[kept++] = pending;
+        }
+    }
+    this->latency_pending_num = kept;
 }
 
 void FSM::handle() {
@@ -144,83 +198,235 @@ void FSM::handle() {
 }
 
 void FSM::handle(unsigned int num_events) {
-    // Handle dirtied FSM globals
+    const uint32_t show_count_before = EFLed.getPushedFrameCount();
+
+    // Handle dirtied FSM globals. Written after a while to coalesce bursts of changes.
     if (this->state->isGlobalsDirty()) {
-        this->persistGlobals();
+        if (this->job_persist != EFSCHEDULER_INVALID_JOB) {
+            EFScheduler.startOnce(this->job_persist, FSM_PERSIST_DELAY_MS);
+        } else {
+            this->persistGlobals();
+        }
         this->state->resetGlobalsDirty();
     }
 
-    // Handle state run()
-    if (
-        this->state->getTickRateMs() == 0 ||
-        millis() >= this->state_last_run + this->state->getTickRateMs()
-    ) {
-        this->state_last_run = millis();
-        this->state->run();
+    this->trackPhotonLatency();
+    this->runState();
+    this->processEvents(num_events);
+
+    // Advance feedback effects queued by the state or event handlers
+    EFLedEffects.update();
+
+    // Attribute the energy used since the last cycle to the current state
+    EFEnergy.update(EFLed.getEstimatedCurrent() * 1000UL);
+
+    // Track LED strip pushes caused by this cycle
+    this->tick_show_count = EFLed.getPushedFrameCount() - show_count_before;
+    if (this->tick_show_count > this->tick_show_count_max) {
+        this->tick_show_count_max = this->tick_show_count;
+        LOGF_DEBUG("(FSM) New maximum of LED pushes per tick: %d\r\n", this->tick_show_count_max);
+    }
+
+    // Report frames saved by stretched tick rates
+    if (millis() - this->frames_saved_window_start_ms >= FSM_FRAMES_SAVED_WINDOW_MS) {
+        this->frames_saved_per_minute = this->frames_saved - this->frames_saved_window_start;
+        this->frames_saved_window_start = this->frames_saved;
+        this->frames_saved_window_start_ms = millis();
+        LOGF_DEBUG("(FSM) Adaptive tick rate saved %d frames/min\r\n", this->frames_saved_per_minute);
+    }
+}
+
+void FSM::runState() {
+    const unsigned int base_ms = this->state->getTickRateMs();
+    const unsigned int max_ms = max(base_ms, this->state->getMaxTickRateMs());
+    if (this->state_interval_ms < base_ms || this->state_interval_ms > max_ms) {
+        this->state_interval_ms = base_ms;
+    }
+
+    const unsigned int now = millis();
+    const unsigned int elapsed = now - this->state_last_run;
+    if (base_ms == 0 || elapsed >= this->state_interval_ms) {
+        // Advance by whole intervals to stay phase-locked. Late runs do not
+        // delay the following ones, periods missed entirely are skipped.
+        if (base_ms == 0) {
+            this->state_last_run = now;
+        } else {
+            this->state_last_run = now - elapsed % this->state_interval_ms;
+        }
+        if (base_ms > 0) {
+            this->frames_saved += this->state_interval_ms / base_ms - 1;
+        }
+
+        const uint32_t pushed_before = EFLed.getPushedFrameCount();
+        EFHeap.beginTick();
+        {
+            EFLedFrameGuard frame(EFLed);
+            this->state->run();
+        }
+
+        // Render code must not touch the heap, see EFHeapClass
+        const uint32_t heap_ops = EFHeap.endTick();
+        if (heap_ops > 0) {
+            LOGF_WARNING("(FSM) %s::run() performed %d heap operations\r\n", this->state->getName(), heap_ops);
+#ifdef EFHEAP_ASSERT_NO_ALLOC
+            assert(heap_ops == 0);
+#endif
+        }
+
+        // Run less often while the output does not visibly change
+        const uint8_t delta = EFLed.getPushedFrameCount() != pushed_before ? EFLed.getFrameDelta() : 0;
+        if (delta < EFLED_PERCEPTUAL_DELTA_VISIBLE) {
+            this->state_interval_ms = min(this->state_interval_ms * 2, max_ms);
+        } else {
+            this->state_interval_ms = max(this->state_interval_ms / 2, base_ms);
+        }
+    }
+}
+
+void FSM::processEvents(unsigned int num_events) {
+    // Report events lost since the last cycle. Can not be logged by the producer, which might be an ISR.
+    const uint32_t dropped = this->eventqueue.getDroppedCount();
+    if (dropped != this->events_dropped_reported) {
+        LOGF_WARNING(
+            "(FSM) Event queue full: dropped %lu events in %lu overflows since boot\r\n",
+            (unsigned long) dropped,
+            (unsigned long) this->eventqueue.getOverflowCount()
+        );
+        this->events_dropped_reported = dropped;
     }
 
-    // Handle events
     for (; num_events > 0; num_events--) {
-        FSMEvent event = this->dequeueEvent();
-        std::unique_ptr<FSMState> next = nullptr;
-
-        // Propagate event to current state
-        switch(event) {
-            case FSMEvent::FingerprintTouch:
-                LOGF_DEBUG("(FSM) Processing Event: FingerprintTouch@%s\r\n", this->state->getName());
-                next = this->state->touchEventFingerprintTouch();
-                break;
-            case FSMEvent::FingerprintRelease:
-                LOGF_DEBUG("(FSM) Processing Event: FingerprintRelease@%s\r\n", this->state->getName());
-                next = this->state->touchEventFingerprintRelease();
-                break;
-            case FSMEvent::FingerprintShortpress:
-                LOGF_DEBUG("(FSM) Processing Event: FingerprintShortpress@%s\r\n", this->state->getName());
-                next = this->state->touchEventFingerprintShortpress();
-                break;
-            case FSMEvent::FingerprintLongpress:
-                LOGF_DEBUG("(FSM) Processing Event: FingerprintLongpress@%s\r\n", this->state->getName());
-                next = this->state->touchEventFingerprintLongpress();
-                break;
-            case FSMEvent::NoseTouch:
-                LOGF_DEBUG("(FSM) Processing Event: NoseTouch@%s\r\n", this->state->getName());
-                next = this->state->touchEventNoseTouch();
-                break;
-            case FSMEvent::NoseRelease:
-                LOGF_DEBUG("(FSM) Processing Event: NoseRelease@%s\r\n", this->state->getName());
-                next = this->state->touchEventNoseRelease();
-                break;
-            case FSMEvent::NoseShortpress:
-                LOGF_DEBUG("(FSM) Processing Event: NoseShortpress@%s\r\n", this->state->getName());
-                next = this->state->touchEventNoseShortpress();
-                break;
-            case FSMEvent::NoseLongpress:
-                LOGF_DEBUG("(FSM) Processing Event: NoseLongpress@%s\r\n", this->state->getName());
-                next = this->state->touchEventNoseLongpress();
-                break;
-            case FSMEvent::AllShortpress:
-                LOGF_DEBUG("(FSM) Processing Event: AllShortpress@%s\r\n", this->state->getName());
-                next = this->state->touchEventAllShortpress();
-                break;
-            case FSMEvent::AllLongpress:
-                LOGF_DEBUG("(FSM) Processing Event: AllLongpress@%s\r\n", this->state->getName());
-                next = this->state->touchEventAllLongpress();
-                break;
-            case FSMEvent::NoOp:
-                return;
-            default:
-                LOGF_WARNING("(FSM) Failed to handle unknown event: %d\r\n", event);
-                return;
-        } 
-
-        // Handle state transition
-        if (next != nullptr) {
-            this->transition(move(next));
+        const FSMTimedEvent timed = this->dequeueEvent();
+        const FSMEvent event = timed.event;
+        FSMStatePtr next = nullptr;
+
+        // Remember the output state to detect when the reaction reached the LEDs
+        const EFLedOutput* output = EFLed.getOutput();
+        const uint32_t frames_submitted = output ? output->getSubmittedFrameCount() : 0;
+        const uint32_t dequeued_us = micros();
+
+        // Batch all LED updates of the handler, exit() and entry() into one push
+        {
+            EFLedFrameGuard frame(EFLed);
+
+            // Propagate event to current state
+            switch(event) {
+                case FSMEvent::FingerprintTouch:
+                    LOGF_DEBUG("(FSM) Processing Event: FingerprintTouch@%s\r\n", this->state->getName());
+                    next = this->state->touchEventFingerprintTouch();
+                    break;
+                case FSMEvent::FingerprintRelease:
+                    LOGF_DEBUG("(FSM) Processing Event: FingerprintRelease@%s\r\n", this->state->getName());
+                    next = this->state->touchEventFingerprintRelease();
+                    break;
+                case FSMEvent::FingerprintShortpress:
+                    LOGF_DEBUG("(FSM) Processing Event: FingerprintShortpress@%s\r\n", this->state->getName());
+                    next = this->state->touchEventFingerprintShortpress();
+                    break;
+                case FSMEvent::FingerprintLongpress:
+                    LOGF_DEBUG("(FSM) Processing Event: FingerprintLongpress@%s\r\n", this->state->getName());
+                    next = this->state->touchEventFingerprintLongpress();
+                    break;
+                case FSMEvent::NoseTouch:
+                    LOGF_DEBUG("(FSM) Processing Event: NoseTouch@%s\r\n", this->state->getName());
+                    next = this->state->touchEventNoseTouch();
+                    break;
+                case FSMEvent::NoseRelease:
+                    LOGF_DEBUG("(FSM) Processing Event: NoseRelease@%s\r\n", this->state->getName());
+                    next = this->state->touchEventNoseRelease();
+                    break;
+                case FSMEvent::NoseShortpress:
+                    LOGF_DEBUG("(FSM) Processing Event: NoseShortpress@%s\r\n", this->state->getName());
+                    next = this->state->touchEventNoseShortpress();
+                    break;
+                case FSMEvent::NoseLongpress:
+                    LOGF_DEBUG("(FSM) Processing Event: NoseLongpress@%s\r\n", this->state->getName());
+                    next = this->state->touchEventNoseLongpress();
+                    break;
+                case FSMEvent::AllShortpress:
+                    LOGF_DEBUG("(FSM) Processing Event: AllShortpress@%s\r\n", this->state->getName());
+                    next = this->state->touchEventAllShortpress();
+                    break;
+                case FSMEvent::AllLongpress:
+                    LOGF_DEBUG("(FSM) Processing Event: AllLongpress@%s\r\n", this->state->getName());
+                    next = this->state->touchEventAllLongpress();
+                    break;
+                case FSMEvent::NoOp:
+                    return;
+                default:
+                    LOGF_WARNING("(FSM) Failed to handle unknown event: %d\r\n", event);
+                    return;
+            }
+
+            // React to input at the full tick rate
+            this->state_interval_ms = 0;
+
+            // Handle state transition
+            if (next != nullptr) {
+                this->transition(move(next));
+            }
+        }
+
+        // Track latencies. Pending events are resolved once the LED output completed a later frame.
+        EFLatencyHistogram* latency = this->latency[(uint8_t) event];
+        latency[(uint8_t) FSMLatencyStage::Dequeue].record(dequeued_us - timed.timestamp_us);
+        latency[(uint8_t) FSMLatencyStage::Handler].record((uint32_t) micros() - timed.timestamp_us);
+        if (output != nullptr) {
+            if (this->latency_pending_num == FSM_LATENCY_PENDING_MAX) {
+                for (uint8_t i = 1; i < FSM_LATENCY_PENDING_MAX; i++) {
+                    this->latency_pending[i - 1] = this->latency_pending[i];
+                }
+                this->latency_pending_num--;
+            }
+            this->latency_pending[this->latency_pending_num++] = {event, timed.timestamp_us, frames_submitted};
         }
     }
 }
 
+unsigned int FSM::getShowCountLastTick() {
+    return this->tick_show_count;
+}
+
+unsigned int FSM::getShowCountMaxTick() {
+    return this->tick_show_count_max;
+}
+
+uint32_t FSM::getFramesSavedPerMinute() {
+    return this->frames_saved_per_minute;
+}
+
+const EFLatencyHistogram& FSM::getLatencyHistogram(FSMEvent event, FSMLatencyStage stage) {
+    return this->latency[(uint8_t) event][(uint8_t) stage];
+}
+
+void FSM::logLatencyReport() {
+    for (uint8_t i = 0; i < FSM_NUM_EVENTS; i++) {
+        const EFLatencyHistogram* latency = this->latency[i];
+        if (latency[(uint8_t) FSMLatencyStage::Dequeue].getCount() == 0) {
+            continue;
+        }
+
+        // All values in us since the event was raised
+        LOGF_INFO(
+            "(FSM) Latency %s (n=%lu): dequeue p50/p99/max = %lu/%lu/%lu, handler = %lu/%lu/%lu, photon (n=%lu) = %lu/%lu/%lu us\r\n",
+            toString((FSMEvent) i),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Dequeue].getCount(),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Dequeue].getPercentile(50),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Dequeue].getPercentile(99),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Dequeue].getMax(),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Handler].getPercentile(50),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Handler].getPercentile(99),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Handler].getMax(),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Photon].getCount(),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Photon].getPercentile(50),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Photon].getPercentile(99),
+            (unsigned long) latency[(uint8_t) FSMLatencyStage::Photon].getMax()
+        );
+    }
+}
+
 void FSM::persistGlobals() {
+    EFScheduler.stop(this->job_persist);
     pref.begin(this->NVS_NAMESPACE, false);
     LOGF_INFO("(FSM) Persisting FSM state data to NVS area: %s\r\n", this->NVS_NAMESPACE);
     pref.clear();
@@ -249,9 +455,17 @@ void FSM::persistGlobals() {
     LOGF_DEBUG("(FSM)  -> huemeshOwnHue = %d\r\n", this->globals->huemeshOwnHue);
     pref.putUInt("cstPatternsIdx", this->globals->cstPatternsIdx);
     LOGF_DEBUG("(FSM)  -> custPatternsIdx = %d\r\n", this->globals->cstPatternsIdx);
+    pref.putUInt("animPlaybackIdx", this->globals->animPlaybackIdx);
+    LOGF_DEBUG("(FSM)  -> animPlaybackIdx = %d\r\n", this->globals->animPlaybackIdx);
     pref.end();
 }
 
+void FSM::flushGlobals() {
+    if (EFScheduler.isPending(this->job_persist)) {
+        this->persistGlobals();
+    }
+}
+
 void FSM::restoreGlobals() {
     pref.begin(this->NVS_NAMESPACE, true);
     LOGF_INFO("(FSM) Restoring FSM state data from NVS area: %s\r\n", this->NVS_NAMESPACE);
@@ -279,5 +493,7 @@ void FSM::restoreGlobals() {
     LOGF_DEBUG("(FSM)  -> huemeshOwnHue = %d\r\n", this->globals->huemeshOwnHue);
     this->globals->cstPatternsIdx = pref.getUInt("cstPatternsIdx", 1);
     LOGF_DEBUG("(FSM)  -> cstPatternsIdx = %d\r\n", this->globals->cstPatternsIdx);
+    this->globals->animPlaybackIdx = pref.getUInt("animPlaybackIdx", 0);
+    LOGF_DEBUG("(FSM)  -> animPlaybackIdx = %d\r\n", this->globals->animPlaybackIdx);
     pref.end();
 }
@@ -30,8 +30,11 @@
 #include <WiFi.h>
 
 #include <EFBoard.h>
+#include <EFEnergy.h>
 #include <EFLogging.h>
 #include <EFLed.h>
+#include <EFLedGeometry.h>
+#include <EFScheduler.h>
 #include <EFTouch.h>
 
 #include "FSM.h"
@@ -40,16 +43,28 @@
 
 // Global objects and states
 constexpr unsigned int INTERVAL_BATTERY_CHECK = 10000;
-// Initializing the board with a brightness above 48 can cause stability issues!
-constexpr uint8_t ABSOLUTE_MAX_BRIGHTNESS = 45;
+constexpr unsigned int INTERVAL_ENERGY_REPORT = 60000;
+constexpr unsigned int INTERVAL_LATENCY_REPORT = 60000;
+constexpr unsigned int INTERVAL_SCHEDULER_REPORT = 60000;
+// Uncorrected full white above a brightness of 48 can cause stability issues!
+// The white balance set in setup() dims green and blue, so full white at 51
+// draws about the same current as uncorrected full white at the old cap of 45.
+// Gamma correction leaves full intensity unchanged. Brightness percentages
+// stored by users map onto this cap.
+// Dense frames are additionally dimmed by EFLed to stay within the budgets below.
+constexpr uint8_t ABSOLUTE_MAX_BRIGHTNESS = 51;
+// Full white at a brightness of 45 is the most the 5V boost converter handles on battery
+constexpr uint16_t LED_CURRENT_BUDGET_BATTERY_MA = 125;
+constexpr uint16_t LED_CURRENT_BUDGET_USB_MA = 180;
 FSM fsm(10);
 EFBoardPowerState pwrstate;
 
-// Task counters
-unsigned long task_fsm_handle = 0;
-unsigned long task_blinkled = 0;
-unsigned long task_battery = 0;
-unsigned long task_brownout = 0;
+// Main loop jobs, see setup()
+EFSchedulerJobId job_fsm_handle = EFSCHEDULER_INVALID_JOB;
+EFSchedulerJobId job_battery = EFSCHEDULER_INVALID_JOB;
+EFSchedulerJobId job_energy = EFSCHEDULER_INVALID_JOB;
+EFSchedulerJobId job_latency = EFSCHEDULER_INVALID_JOB;
+EFSchedulerJobId job_scheduler = EFSCHEDULER_INVALID_JOB;
 
 /**
  * @brief Struct for interrupt event tracking / handling
@@ -67,17 +82,54 @@ volatile struct ISREventsType {
     unsigned char allLongpress:          1;
 } isrEvents;
 
+/**
+ * @brief Time each event was last raised by its ISR at, in microseconds.
+ * Indexed by FSMEvent.
+ */
+volatile uint32_t isrEventUs[FSM_NUM_EVENTS];
+
+/**
+ * @brief Task running loop(). Notified by ISRs to wake it up from sleep.
+ */
+TaskHandle_t loopTaskHandle = nullptr;
+
+/**
+ * @brief Remembers the time an event was raised at and wakes up loop(). Must
+ * be called from ISR context.
+ */
+void ARDUINO_ISR_ATTR raiseIsrEvent(FSMEvent event) {
+    isrEventUs[(uint8_t) event] = micros();
+
+    BaseType_t woken = pdFALSE;
+    if (loopTaskHandle != nullptr) {
+        vTaskNotifyGiveFromISR(loopTaskHandle, &woken);
+    }
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
 // Interrupt service routines to update ISR struct upon triggering
-void ARDUINO_ISR_ATTR isr_fingerprintTouch()      { isrEvents.fingerprintTouch = 1; }
-void ARDUINO_ISR_ATTR isr_fingerprintRelease()    { isrEvents.fingerprintRelease = 1; }
-void ARDUINO_ISR_ATTR isr_fingerprintShortpress() { isrEvents.fingerprintShortpress = 1; }
-void ARDUINO_ISR_ATTR isr_fingerprintLongpress()  { isrEvents.fingerprintLongpress = 1; }
-void ARDUINO_ISR_ATTR isr_noseTouch()             { isrEvents.noseTouch = 1; }
-void ARDUINO_ISR_ATTR isr_noseRelease()           { isrEvents.noseRelease = 1; }
-void ARDUINO_ISR_ATTR isr_noseShortpress()        { isrEvents.noseShortpress = 1; }
-void ARDUINO_ISR_ATTR isr_noseLongpress()         { isrEvents.noseLongpress = 1; }
-void ARDUINO_ISR_ATTR isr_allShortpress()         { isrEvents.allShortpress = 1; }
-void ARDUINO_ISR_ATTR isr_allLongpress()          { isrEvents.allLongpress = 1; }
+void ARDUINO_ISR_ATTR isr_fingerprintTouch()      { isrEvents.fingerprintTouch = 1; raiseIsrEvent(FSMEvent::FingerprintTouch); }
+void ARDUINO_ISR_ATTR isr_fingerprintRelease()    { isrEvents.fingerprintRelease = 1; raiseIsrEvent(FSMEvent::FingerprintRelease); }
+void ARDUINO_ISR_ATTR isr_fingerprintShortpress() { isrEvents.fingerprintShortpress = 1; raiseIsrEvent(FSMEvent::FingerprintShortpress); }
+void ARDUINO_ISR_ATTR isr_fingerprintLongpress()  { isrEvents.fingerprintLongpress = 1; raiseIsrEvent(FSMEvent::FingerprintLongpress); }
+void ARDUINO_ISR_ATTR isr_noseTouch()             { isrEvents.noseTouch = 1; raiseIsrEvent(FSMEvent::NoseTouch); }
+void ARDUINO_ISR_ATTR isr_noseRelease()           { isrEvents.noseRelease = 1; raiseIsrEvent(FSMEvent::NoseRelease); }
+void ARDUINO_ISR_ATTR isr_noseShortpress()        { isrEvents.noseShortpress = 1; raiseIsrEvent(FSMEvent::NoseShortpress); }
+void ARDUINO_ISR_ATTR isr_noseLongpress()         { isrEvents.noseLongpress = 1; raiseIsrEvent(FSMEvent::NoseLongpress); }
+void ARDUINO_ISR_ATTR isr_allShortpress()         { isrEvents.allShortpress = 1; raiseIsrEvent(FSMEvent::AllShortpress); }
+void ARDUINO_ISR_ATTR isr_allLongpress()          { isrEvents.allLongpress = 1; raiseIsrEvent(FSMEvent::AllLongpress); }
+
+/**
+ * @brief Queues an event raised by an ISR, keeping the time the ISR raised it at
+ */
+void queueIsrEvent(FSMEvent event) {
+    fsm.queueEvent(event, isrEventUs[(uint8_t) event]);
+
+    // Handle input right away instead of waiting for the next FSM tick
+    EFScheduler.startOnce(job_fsm_handle);
+}
 
 /**
  * @brief Handles hard brown out events
@@ -90,15 +142,19 @@ void _hardBrownOutHandler() {
     );
     EFBoard.disableWifi();
     // Try getting the LEDs into some known state
-    EFLed.setBrightnessPercent(30);
-    EFLed.clear();
-    EFLed.setDragonNose(CRGB::Red);
+    {
+        EFLedFrameGuard frame(EFLed);
+        EFLed.setBrightnessPercent(30);
+        EFLed.clear();
+        EFLed.setDragonNose(CRGB::Red);
+    }
 
     // Hard brown out can only be cleared by board reset
     while (1) {
         // Low brightness blink every few seconds
         EFLed.enablePower();
         EFLed.setDragonNose(CRGB::Red);
+        EFLed.flush();
         esp_sleep_enable_timer_wakeup(200 * 1000);  // 200 ms
         EFLed.disablePower();
         // sleep most of the time.
@@ -118,9 +174,16 @@ void _softBrownOutHandler() {
         EFBoard.getBatteryVoltage()
     );
     EFBoard.disableWifi();
-    EFLed.clear();
+    // Keep settings not yet written and the energy accounting of the drained batteries
+    fsm.flushGlobals();
+    EFEnergy.persist();
+    EFEnergy.logSummary();
     EFLed.enablePower();
-    EFLed.setBrightnessPercent(40);
+    {
+        EFLedFrameGuard frame(EFLed);
+        EFLed.clear();
+        EFLed.setBrightnessPercent(40);
+    }
 
     // Soft brown out can only be cleared by board reset but can escalate to hard brown out
     while (1) {
@@ -134,6 +197,7 @@ void _softBrownOutHandler() {
         for (uint8_t n = 0; n < 30; n++) {
             EFLed.enablePower();
             EFLed.setDragonNose(CRGB::Red);
+            EFLed.flush();
             esp_sleep_enable_timer_wakeup(300 * 1000);
             esp_light_sleep_start();
             EFLed.disablePower();
@@ -157,6 +221,9 @@ void batteryCheck() {
         LOGF_DEBUG("Updated power state: %s\r\n", toString(pwrstate));
     }
 
+    // The boost converter can deliver more current from USB than from battery
+    EFLed.setCurrentBudget(EFBoard.isBatteryPowered() ? LED_CURRENT_BUDGET_BATTERY_MA : LED_CURRENT_BUDGET_USB_MA);
+
     // Log battery level if battery powered
     if (EFBoard.isBatteryPowered()) {
         LOGF_INFO(
@@ -166,6 +233,13 @@ void batteryCheck() {
         );
     }
 
+    // Log time the LED boost converter was switched off due to dark frames
+    LOGF_DEBUG(
+        "LED power gated for %lu ms in %lu periods\r\n",
+        (unsigned long) EFLed.getPowerGatedMs(),
+        (unsigned long) EFLed.getPowerGatedCount()
+    );
+
     // Handle brown out
     if (pwrstate == EFBoardPowerState::BAT_BROWN_OUT_HARD) {
         _hardBrownOutHandler();
@@ -174,18 +248,52 @@ void batteryCheck() {
     }
 }
 
+/**
+ * @brief Executes a FSM processing cycle and schedules the next one. The FSM
+ * keeps its state runs phase-locked, so re-arming from getMsUntilNextRun()
+ * does not accumulate drift.
+ */
+void jobFsmHandle(void* ctx) {
+    fsm.handle();
+    EFScheduler.startOnce(job_fsm_handle, fsm.getMsUntilNextRun());
+}
+
+/**
+ * @brief Periodically checks the battery, see batteryCheck()
+ */
+void jobBatteryCheck(void* ctx) {
+    batteryCheck();
+}
+
+/**
+ * @brief Periodically logs the energy used per FSM state
+ */
+void jobEnergyReport(void* ctx) {
+    EFEnergy.logSummary();
+}
+
+/**
+ * @brief Periodically logs the input latency histograms
+ */
+void jobLatencyReport(void* ctx) {
+    fsm.logLatencyReport();
+}
+
+/**
+ * @brief Periodically logs the jitter of all main loop jobs
+ */
+void jobSchedulerReport(void* ctx) {
+    EFScheduler.logSummary();
+}
+
 /**
  * @brief Displays a fancy bootup animation
  */
 void boopupAnimation() {
     CRGB data[EFLED_TOTAL_NUM];
-    fill_solid(data, EFLED_TOTAL_NUM, CRGB::Black);
-    EFLed.setAll(data);
     delay(100);
 
-    // Origin point. Power-Button is 11, 25. Make it originate from where the hand is
-    constexpr int16_t pwrX = -30;
-    constexpr int16_t pwrY = 16;
+    // Make it originate from where the hand is, left of the power button
     uint8_t hue = 120;  // Green
 
     for (uint16_t n = 0; n < 30; n++) {
@@ -195,16 +303,13 @@ void boopupAnimation() {
             batteryCheck();
         }
         for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
-            int16_t dx = EFLedClass::getLEDPosition(i).x - pwrX;
-            int16_t dy = EFLedClass::getLEDPosition(i).y - pwrY;
-            float distance = sqrt(dx * dx + dy * dy);
+            uint8_t distance = EFLedGeometry::distanceFrom(EFLedGeometry::Anchor::Hand, i);
 
-            float intensity = wave_function(distance, n_scaled / 2 - 30, n_scaled * 2 + 20, 1.0);
-            intensity = intensity * intensity; // sharpen wave
+            uint8_t intensity = wave_function(distance, n_scaled / 2 - 30, n_scaled * 2 + 20, 255);
 
             // energy front
-            uint8_t value = static_cast<uint8_t>(intensity * 255);
-            data[i] = CHSV((hue + static_cast<uint16_t>(distance * 2.0f)) % 255, 240, value);
+            uint8_t value = scale8(intensity, intensity);  // sharpen wave
+            data[i] = CHSV((hue + distance * 2) % 255, 240, value);
         }
         EFLed.setAll(data);
         delay(15);
@@ -236,10 +341,15 @@ void boopupAnimation() {
  * @brief Initial board setup. Called at boot / board reset.
  */
 void setup() {
+    loopTaskHandle = xTaskGetCurrentTaskHandle();
+
     // Init board
     EFBoard.setup();
+    EFEnergy.begin();
     EFLed.init(ABSOLUTE_MAX_BRIGHTNESS);
-    EFLed.setBrightnessPercent(40);  // We do not have access to the settings yet, default to 40
+    EFLed.setGammaCorrection(true);
+    EFLed.setWhiteBalance(TypicalSMD5050);  // WS2812B LEDs come in 5050 packages
+    EFLed.setBrightnessPercent(40);  // We do not have access to the settings yet, default to 40. Pushes a black frame.
     boopupAnimation();
     
     // Touchy stuff
@@ -255,6 +365,21 @@ void setup() {
     EFTouch.attachInterruptOnShortpress(EFTouchZone::All, isr_allShortpress);
     EFTouch.attachInterruptOnLongpress(EFTouchZone::All, isr_allLongpress);
 
+    // Sleep whenever loop() waits for its next job
+    EFBoard.enableAutoLightSleep();
+
+    // Main loop jobs. Periodic jobs stay phase-locked to their first deadline.
+    job_fsm_handle = EFScheduler.add("fsm", jobFsmHandle);
+    job_battery = EFScheduler.add("battery", jobBatteryCheck);
+    job_energy = EFScheduler.add("energy", jobEnergyReport);
+    job_latency = EFScheduler.add("latency", jobLatencyReport);
+    job_scheduler = EFScheduler.add("scheduler", jobSchedulerReport);
+    EFScheduler.startOnce(job_fsm_handle);
+    EFScheduler.startPeriodic(job_battery, INTERVAL_BATTERY_CHECK);
+    EFScheduler.startPeriodic(job_energy, INTERVAL_ENERGY_REPORT);
+    EFScheduler.startPeriodic(job_latency, INTERVAL_LATENCY_REPORT);
+    EFScheduler.startPeriodic(job_scheduler, INTERVAL_SCHEDULER_REPORT, INTERVAL_SCHEDULER_REPORT);
+
     // Get FSM going
     fsm.resume();
 	
@@ -266,7 +391,7 @@ void setup() {
 void loop() {
     // Handler: ISR Events
     if (isrEvents.allLongpress) {
-        fsm.queueEvent(FSMEvent::AllLongpress);
+        queueIsrEvent(FSMEvent::AllLongpress);
         isrEvents.noseLongpress = false;
         isrEvents.noseShortpress = false;
         isrEvents.noseRelease = false;
@@ -277,7 +402,7 @@ void loop() {
         isrEvents.allShortpress = false;
     }
     if (isrEvents.allShortpress) {
-        fsm.queueEvent(FSMEvent::AllShortpress);
+        queueIsrEvent(FSMEvent::AllShortpress);
         isrEvents.noseShortpress = false;
         isrEvents.noseRelease = false;
         isrEvents.fingerprintShortpress = false;
@@ -285,55 +410,52 @@ void loop() {
         isrEvents.allShortpress = false;
     }
     if (isrEvents.fingerprintTouch) {
-        fsm.queueEvent(FSMEvent::FingerprintTouch);
+        queueIsrEvent(FSMEvent::FingerprintTouch);
         isrEvents.fingerprintTouch = false;
     }
     if (isrEvents.fingerprintLongpress) {
-        fsm.queueEvent(FSMEvent::FingerprintLongpress);
+        queueIsrEvent(FSMEvent::FingerprintLongpress);
         isrEvents.fingerprintLongpress = false;
         isrEvents.fingerprintShortpress = false;
         isrEvents.fingerprintRelease = false;
     }
     if (isrEvents.fingerprintShortpress) {
-        fsm.queueEvent(FSMEvent::FingerprintShortpress);
+        queueIsrEvent(FSMEvent::FingerprintShortpress);
         isrEvents.fingerprintShortpress = false;
         isrEvents.fingerprintRelease = false;
     }
     if (isrEvents.fingerprintRelease) {
-        fsm.queueEvent(FSMEvent::FingerprintRelease);
+        queueIsrEvent(FSMEvent::FingerprintRelease);
         isrEvents.fingerprintRelease = false;
     }
 
     if (isrEvents.noseTouch) {
-        fsm.queueEvent(FSMEvent::NoseTouch);
+        queueIsrEvent(FSMEvent::NoseTouch);
         isrEvents.noseTouch = false;
     }
     if (isrEvents.noseLongpress) {
-        fsm.queueEvent(FSMEvent::NoseLongpress);
+        queueIsrEvent(FSMEvent::NoseLongpress);
         isrEvents.noseLongpress = false;
         isrEvents.noseShortpress = false;
         isrEvents.noseRelease = false;
     }
     if (isrEvents.noseShortpress) {
-        fsm.queueEvent(FSMEvent::NoseShortpress);
+        queueIsrEvent(FSMEvent::NoseShortpress);
         isrEvents.noseShortpress = false;
         isrEvents.noseRelease = false;
     }
     if (isrEvents.noseRelease) {
-        fsm.queueEvent(FSMEvent::NoseRelease);
+        queueIsrEvent(FSMEvent::NoseRelease);
         isrEvents.noseRelease = false;
     }
 
-    // Task: Handle FSM
-    if (task_fsm_handle < millis()) {
-        fsm.handle();
-        task_fsm_handle = millis() + fsm.getTickRateMs();
-    }
-
-    // Task: Battery checks
-    if (task_battery < millis()) {
-        batteryCheck();
-        task_battery = millis() + INTERVAL_BATTERY_CHECK;
+    // Run due jobs, then block until the next deadline or until an ISR raised
+    // an event. Pending notifications from ISRs that fired since the checks
+    // above end the wait immediately. The idle task puts the chip into light
+    // sleep meanwhile.
+    const uint32_t idle_ms = EFScheduler.run();
+    if (idle_ms > 0) {
+        ulTaskNotifyTake(pdTRUE, idle_ms == EFSCHEDULER_NO_DEADLINE ? portMAX_DELAY : pdMS_TO_TICKS(idle_ms));
     }
 	
 }
@@ -21,7 +21,11 @@
 // IN THE SOFTWARE.
 
 #include <EFLed.h>
+#include <EFLedEffects.h>
+#include <EFLedGeometry.h>
+#include <EFLedPalette.h>
 #include <EFLogging.h>
+#include <EFMath.h>
 
 #include "FSMState.h"
 
@@ -39,6 +43,7 @@ const unsigned int AnimateHeartbeat::getTickRateMs() {
 
 void AnimateHeartbeat::entry() {
     this->tick = 0;
+    this->ramp = &EFLedPalette.get(this->globals->animHeartbeatHue);
 }
 
 void AnimateHeartbeat::run() {
@@ -46,18 +51,14 @@ void AnimateHeartbeat::run() {
     fill_solid(data, EFLED_TOTAL_NUM, CRGB::Black);
 
     for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
-        float dx = EFLedClass::getLEDPosition(i).x - EFLedClass::getLEDPosition(EFLED_DRAGON_EYE_IDX).x;
-        float dy = EFLedClass::getLEDPosition(i).y - EFLedClass::getLEDPosition(EFLED_DRAGON_EYE_IDX).y;
-        float distance = sqrt(dx * dx + dy * dy);
+        uint8_t distance = EFLedGeometry::distanceFrom(EFLedGeometry::Anchor::Eye, i);
 
-        // LEDs further away from the eye lag behind
-        float t = tick / 40.0 - distance / 80.0;
+        // One beat every 80 ticks. LEDs further away from the eye lag behind by half a beat per 80 mm.
+        const uint16_t angle = (this->tick % 80) * EFMath::ANGLE_HALF_TURN / 40 - distance * EFMath::ANGLE_HALF_TURN / 80;
 
-        float intensity = sin(t * 1.0 * M_PI);
-        intensity = intensity < 0.0 ? 0.0 : intensity;
-
-        uint8_t value = static_cast<uint8_t>(intensity * 255);
-        data[i] = CHSV(this->globals->animHeartbeatHue, 255, value);
+        const int16_t intensity = EFMath::sin(angle);
+        uint8_t value = intensity < 0 ? 0 : ((int32_t) intensity * 255) >> 15;
+        data[i] = (*this->ramp)[value];
     }
 
     EFLed.setAll(data);
@@ -66,19 +67,19 @@ void AnimateHeartbeat::run() {
     this->tick = this->tick + this->globals->animHeartbeatSpeed + 1;
 }
 
-std::unique_ptr<FSMState> AnimateHeartbeat::touchEventFingerprintShortpress() {
+FSMStatePtr AnimateHeartbeat::touchEventFingerprintShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    return std::make_unique<MenuMain>();
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> AnimateHeartbeat::touchEventFingerprintLongpress() {
+FSMStatePtr AnimateHeartbeat::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
-std::unique_ptr<FSMState> AnimateHeartbeat::touchEventNoseRelease() {
+FSMStatePtr AnimateHeartbeat::touchEventNoseRelease() {
     if (this->isLocked()) {
         return nullptr;
     }
@@ -90,18 +91,16 @@ std::unique_ptr<FSMState> AnimateHeartbeat::touchEventNoseRelease() {
         this->globals->animHeartbeatHue = (this->globals->animHeartbeatHue + 20) % 255;
     }
     this->is_globals_dirty = true;
+    this->ramp = &EFLedPalette.get(this->globals->animHeartbeatHue);
 
-    EFLed.setDragonEye(CRGB::Black);
-    delay(100);
-    EFLed.setDragonEye(CHSV(this->globals->animHeartbeatHue, 255, 255));
-    delay(300);
-    EFLed.setDragonEye(CRGB::Black);
+    EFLedEffects.pushSolid({EFLED_DRAGON_EYE_IDX, 1}, CRGB::Black, 100);
+    EFLedEffects.pushSolid({EFLED_DRAGON_EYE_IDX, 1}, CHSV(this->globals->animHeartbeatHue, 255, 255), 300);
 
     this->tick = 0;
     return nullptr;
 }
 
-std::unique_ptr<FSMState> AnimateHeartbeat::touchEventNoseShortpress() {
+FSMStatePtr AnimateHeartbeat::touchEventNoseShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
@@ -109,24 +108,17 @@ std::unique_ptr<FSMState> AnimateHeartbeat::touchEventNoseShortpress() {
     this->globals->animHeartbeatSpeed = (this->globals->animHeartbeatSpeed + 1) % 3;
     this->is_globals_dirty = true;
 
-    CRGB data[EFLED_EFBAR_NUM];
-    fill_solid(data, EFLED_EFBAR_NUM, CRGB::Black);
-    EFLed.setEFBar(data);
-    delay(100);
-    fill_solid(data, this->globals->animHeartbeatSpeed + 1, CRGB::Red);
-    EFLed.setEFBar(data);
-    delay(300);
-    fill_solid(data, this->globals->animHeartbeatSpeed + 1, CRGB::Black);
-    EFLed.setEFBar(data);
-    delay(200);
-    fill_solid(data, this->globals->animHeartbeatSpeed + 1, CRGB::Red);
-    EFLed.setEFBar(data);
-    delay(400);
+    // Show the new speed level on the EF bar
+    const uint8_t level = this->globals->animHeartbeatSpeed + 1;
+    EFLedEffects.pushBar(0, CRGB::Red, CRGB::Black, 100);
+    EFLedEffects.pushBar(level, CRGB::Red, CRGB::Black, 300);
+    EFLedEffects.pushBar(0, CRGB::Red, CRGB::Black, 200);
+    EFLedEffects.pushBar(level, CRGB::Red, CRGB::Black, 400);
 
     return nullptr;
 }
 
-std::unique_ptr<FSMState> AnimateHeartbeat::touchEventAllLongpress() {
+FSMStatePtr AnimateHeartbeat::touchEventAllLongpress() {
     this->toggleLock();
     return nullptr;
 }
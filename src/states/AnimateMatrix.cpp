@@ -25,6 +25,7 @@
  */
 
 #include <EFLed.h>
+#include <EFLedFrameCache.h>
 #include <EFLogging.h>
 
 #include "FSMState.h"
@@ -41,6 +42,12 @@ const int hue_list[] = {
     80,
 };
 
+/**
+ * @brief Number of ticks after which the matrix animation repeats,
+ * lcm(EFLED_DRAGON_NUM, EFLED_EFBAR_NUM)
+ */
+#define ANIMATE_MATRIX_PERIOD 66
+
 const char* AnimateMatrix::getName() {
     return "AnimateMatrix";
 }
@@ -57,11 +64,18 @@ void AnimateMatrix::entry() {
     this->tick = 0;
 }
 
-void AnimateMatrix::run() {
+/**
+ * @brief Renders a single frame of the matrix animation
+ *
+ * @param tick Tick to render
+ * @param param Index into hue_list
+ * @param out Buffer to write all LEDs to
+ */
+static void renderMatrix(uint32_t tick, uint32_t param, CRGB* out) {
     // map the 360 degree hue value to a byte
-    int mappedHue = map(hue_list[this->globals->animMatrixIdx], 0, 359, 0, 255);
+    int mappedHue = map(hue_list[param], 0, 359, 0, 255);
 
-    std::vector<CRGB> dragon = {
+    CRGB dragon[EFLED_DRAGON_NUM] = {
         CRGB::Black,
         CHSV(mappedHue, 255, 40),
         CHSV(mappedHue, 255, 110),
@@ -70,7 +84,7 @@ void AnimateMatrix::run() {
         CRGB::Black
     };
 
-    std::vector<CRGB> bar = {
+    CRGB bar[EFLED_EFBAR_NUM] = {
         CHSV(mappedHue, 255, 50),
         CHSV(mappedHue, 255, 110),
         CHSV(mappedHue, 255, 255),
@@ -85,29 +99,39 @@ void AnimateMatrix::run() {
     };
 
     // Calculate current pattern based on tick
-    std::rotate(dragon.begin(), dragon.begin() + this->tick % EFLED_DRAGON_NUM, dragon.end());
-    std::rotate(bar.rbegin(), bar.rbegin() + this->tick % EFLED_EFBAR_NUM, bar.rend());
+    std::rotate(dragon, dragon + tick % EFLED_DRAGON_NUM, dragon + EFLED_DRAGON_NUM);
+    std::rotate(bar, bar + EFLED_EFBAR_NUM - tick % EFLED_EFBAR_NUM, bar + EFLED_EFBAR_NUM);
+
+    std::copy(dragon, dragon + EFLED_DRAGON_NUM, out + EFLED_DARGON_OFFSET);
+    std::copy(bar, bar + EFLED_EFBAR_NUM, out + EFLED_EFBAR_OFFSET);
+}
 
-    dragon.insert(dragon.end(), bar.begin(), bar.end());
-    EFLed.setAll(dragon.data());
+void AnimateMatrix::run() {
+    EFLed.setAll(EFLedFrameCache.get(
+        &renderMatrix,
+        this->globals->animMatrixIdx,
+        ANIMATE_MATRIX_PERIOD,
+        EFLED_TOTAL_NUM,
+        this->tick
+    ));
 
     // Prepare next tick
     this->tick++;
 }
 
-std::unique_ptr<FSMState> AnimateMatrix::touchEventFingerprintShortpress() {
+FSMStatePtr AnimateMatrix::touchEventFingerprintShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    return std::make_unique<MenuMain>();
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> AnimateMatrix::touchEventFingerprintLongpress() {
+FSMStatePtr AnimateMatrix::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
-std::unique_ptr<FSMState> AnimateMatrix::touchEventFingerprintRelease() {
+FSMStatePtr AnimateMatrix::touchEventFingerprintRelease() {
     if (this->isLocked()) {
         return nullptr;
     }
@@ -119,7 +143,7 @@ std::unique_ptr<FSMState> AnimateMatrix::touchEventFingerprintRelease() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> AnimateMatrix::touchEventAllLongpress() {
+FSMStatePtr AnimateMatrix::touchEventAllLongpress() {
     this->toggleLock();
     return nullptr;
 }
@@ -31,6 +31,17 @@
 #include "FSMState.h"
 
 #define ANIMATE_RAINBOW_NUM_TOTAL 3  //!< Number of available animations
+#define ANIMATE_RAINBOW_CIRCLE_PERIOD 128  //!< Number of ticks after which the rainbow circle repeats
+
+/**
+ * @brief Full rainbow as used by fill_rainbow_circular(), one color per hue
+ */
+static CRGB rainbow_palette[256];
+
+/**
+ * @brief Hue of every LED of the rainbow circle, relative to its first LED
+ */
+static uint8_t rainbow_circle_indices[EFLED_TOTAL_NUM];
 
 /**
  * @brief Index of all animations, each consisting of a periodically called
@@ -62,12 +73,16 @@ void AnimateRainbow::entry() {
     this->tick = 0;
 }
 
+void AnimateRainbow::exit() {
+    EFLed.clearIndexed();
+}
+
 void AnimateRainbow::run() {
     (*this.*(animations[this->globals->animRainbowIdx % ANIMATE_RAINBOW_NUM_TOTAL].animate))();
     this->tick++;
 }
 
-std::unique_ptr<FSMState> AnimateRainbow::touchEventFingerprintRelease() {
+FSMStatePtr AnimateRainbow::touchEventFingerprintRelease() {
     if (this->isLocked()) {
         return nullptr;
     }
@@ -85,15 +100,15 @@ std::unique_ptr<FSMState> AnimateRainbow::touchEventFingerprintRelease() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> AnimateRainbow::touchEventFingerprintShortpress() {
+FSMStatePtr AnimateRainbow::touchEventFingerprintShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    return std::make_unique<MenuMain>();
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> AnimateRainbow::touchEventFingerprintLongpress() {
+FSMStatePtr AnimateRainbow::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
@@ -102,12 +117,25 @@ void AnimateRainbow::_animateRainbow() {
 }
 
 void AnimateRainbow::_animateRainbowCircle() {
-    CRGB data[EFLED_TOTAL_NUM];
-    fill_rainbow_circular(data, EFLED_TOTAL_NUM, (tick % 128)*2, true);
-    EFLed.setAll(data);
+    // Spread the rainbow once across all LEDs, then only rotate the palette
+    if (!EFLed.isIndexed()) {
+        fill_rainbow(rainbow_palette, 256, 0, 1);
+
+        // Same hue spacing as fill_rainbow_circular(..., reversed = true)
+        const uint16_t hueChange = 65535 / (uint16_t) EFLED_TOTAL_NUM;
+        uint16_t hueOffset = 0;
+        for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+            rainbow_circle_indices[i] = hueOffset >> 8;
+            hueOffset -= hueChange;
+        }
+
+        EFLed.setIndexed(EFLED_REGION_ALL, rainbow_circle_indices, rainbow_palette, 256);
+    }
+
+    EFLed.setPaletteOffset((tick % ANIMATE_RAINBOW_CIRCLE_PERIOD)*2);
 }
 
-std::unique_ptr<FSMState> AnimateRainbow::touchEventAllLongpress() {
+FSMStatePtr AnimateRainbow::touchEventAllLongpress() {
     this->toggleLock();
     return nullptr;
 }
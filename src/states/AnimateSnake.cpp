@@ -24,15 +24,22 @@
  * @author Honigeintopf
  */
 
+#include <algorithm>
+
 #include <EFLed.h>
+#include <EFLedFrameCache.h>
+#include <EFLedPalette.h>
+#include <EFLedPixels.h>
 #include <EFLogging.h>
 #include <EFPrideFlags.h>
-#include <vector>
 
 #include "FSMState.h"
 
 #define ANIMATE_SNAKE_NUM_TOTAL 4  //!< Number of available animations
 #define ANIMATE_HUE_NUM_TOTAL 5   //!< Number of available hues
+#define ANIMATE_SNAKE_PERIOD EFLED_TOTAL_NUM  //!< Number of ticks after which the snake repeats
+#define ANIMATE_KNIGHTRIDER_PERIOD 16         //!< Number of ticks after which the knight rider repeats
+#define ANIMATE_PULSE_PERIOD 5                //!< Number of ticks after which the pulse repeats
 
 /**
  * @brief Index of all animations, each consisting of a periodically called
@@ -72,6 +79,8 @@ const unsigned int AnimateSnake::getTickRateMs() {
 
 void AnimateSnake::entry() {
     this->tick = 0;
+    const CHSV& hue = hueList[this->globals->animSnakeHueIdx];
+    this->ramp = &EFLedPalette.get(hue.hue, hue.sat);
 }
 
 void AnimateSnake::run() {
@@ -79,7 +88,7 @@ void AnimateSnake::run() {
     this->tick++;
 }
 
-std::unique_ptr<FSMState> AnimateSnake::touchEventFingerprintRelease() {
+FSMStatePtr AnimateSnake::touchEventFingerprintRelease() {
     if (this->isLocked()) {
         return nullptr;
     }
@@ -92,6 +101,8 @@ std::unique_ptr<FSMState> AnimateSnake::touchEventFingerprintRelease() {
     }
     this->is_globals_dirty = true;
     this->tick = 0;
+    const CHSV& hue = hueList[this->globals->animSnakeHueIdx];
+    this->ramp = &EFLedPalette.get(hue.hue, hue.sat);
     EFLed.clear();
 
     LOGF_INFO(
@@ -102,19 +113,26 @@ std::unique_ptr<FSMState> AnimateSnake::touchEventFingerprintRelease() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> AnimateSnake::touchEventFingerprintShortpress() {
+FSMStatePtr AnimateSnake::touchEventFingerprintShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    return std::make_unique<MenuMain>();
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> AnimateSnake::touchEventFingerprintLongpress() {
+FSMStatePtr AnimateSnake::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
-void AnimateSnake::_animateKnightRider() {
+/**
+ * @brief Renders a single frame of the knight rider animation
+ *
+ * @param tick Tick to render
+ * @param param Index into hueList
+ * @param out Buffer to write the EF bar LEDs to
+ */
+static void renderKnightRider(uint32_t tick, uint32_t param, CRGB* out) {
     // Calculate pattern
     uint16_t pattern = 0b111 << (EFLED_EFBAR_NUM - 3);
     if (tick % 16 < 8) {
@@ -126,77 +144,90 @@ void AnimateSnake::_animateKnightRider() {
     }
 
     // Translate pattern to LED colors
-    CRGB colors[EFLED_EFBAR_NUM] = {};
     for (uint8_t i = 0; i < EFLED_EFBAR_NUM; i++) {
-        if (pattern & 0b1) {
-            colors[i] = hueList[this->globals->animSnakeHueIdx];
-        }
+        out[i] = (pattern & 0b1) ? CRGB(hueList[param]) : CRGB(CRGB::Black);
         pattern >>= 1;
     }
+}
+
+void AnimateSnake::_animateKnightRider() {
+    EFLed.setEFBar(EFLedFrameCache.get(
+        &renderKnightRider,
+        this->globals->animSnakeHueIdx,
+        ANIMATE_KNIGHTRIDER_PERIOD,
+        EFLED_EFBAR_NUM,
+        this->tick
+    ));
+}
+
+/**
+ * @brief Renders a single frame of the snake animation
+ *
+ * @param tick Tick to render
+ * @param param Index into hueList
+ * @param out Buffer to write all LEDs to
+ */
+static void renderSnake(uint32_t tick, uint32_t param, CRGB* out) {
+    // Snake of three LEDs, moving by one LED per tick
+    EFLedPixels<EFLED_TOTAL_NUM> pattern(EFLED_TOTAL_NUM, CRGB::Black);
+    for (uint8_t i = 0; i < 3; i++) {
+        pattern[i] = hueList[param];
+    }
 
-    // Apply
-    EFLed.setEFBar(colors);
+    std::rotate(pattern.begin(), pattern.end() - tick % EFLED_TOTAL_NUM, pattern.end());
+    std::copy(pattern.begin(), pattern.end(), out);
 }
 
 void AnimateSnake::_animateSnake() {
-    std::vector<CRGB> pattern = {
-        hueList[this->globals->animSnakeHueIdx],
-        hueList[this->globals->animSnakeHueIdx],
-        hueList[this->globals->animSnakeHueIdx],
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-    };
-
-    std::rotate(pattern.rbegin(), pattern.rbegin() + this->tick % EFLED_TOTAL_NUM, pattern.rend());
-    EFLed.setAll(pattern.data());
+    EFLed.setAll(EFLedFrameCache.get(
+        &renderSnake,
+        this->globals->animSnakeHueIdx,
+        ANIMATE_SNAKE_PERIOD,
+        EFLED_TOTAL_NUM,
+        this->tick
+    ));
 }
 
-std::unique_ptr<FSMState> AnimateSnake::touchEventAllLongpress() {
+FSMStatePtr AnimateSnake::touchEventAllLongpress() {
     this->toggleLock();
     return nullptr;
 }
 
-void AnimateSnake::_animatePulse() {
-
-    // Create half of the pattern
-    std::vector<CRGB> patternFirstHalf = {
-        hueList[this->globals->animSnakeHueIdx],
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-        CRGB::Black,
-    };
-    // shift the active LED
-    std::rotate(patternFirstHalf.rbegin(), patternFirstHalf.rbegin() + this->tick % 5, patternFirstHalf.rend());
-
-    // copy the pattern and flip it
-    std::vector<CRGB> patternSecondHalf = patternFirstHalf;
-    std::reverse(patternSecondHalf.begin(), patternSecondHalf.end());
-
-    // Handle the center LED. Only light it in the last part of the animation
-    if(patternSecondHalf[0] == hueList[this->globals->animSnakeHueIdx]) {
-        patternFirstHalf.insert(patternFirstHalf.end(), hueList[this->globals->animSnakeHueIdx]);
-    }else{
-        patternFirstHalf.insert(patternFirstHalf.end(), CRGB::Black);
+/**
+ * @brief Renders a single frame of the pulse animation
+ *
+ * @param tick Tick to render
+ * @param param Index into hueList
+ * @param out Buffer to write the EF bar LEDs to
+ */
+static void renderPulse(uint32_t tick, uint32_t param, CRGB* out) {
+    const CRGB color = hueList[param];
+
+    // Create half of the pattern and shift the active LED
+    EFLedPixels<5> half(5, CRGB::Black);
+    half[0] = color;
+    std::rotate(half.begin(), half.end() - tick % 5, half.end());
+
+    // Mirror the half around the center LED. Only light the center in the
+    // last part of the animation
+    EFLedPixels<EFLED_EFBAR_NUM> pattern;
+    pattern.append(half.data(), half.size());
+    pattern.push(half[half.size() - 1] == color ? color : CRGB(CRGB::Black));
+    for (uint8_t i = half.size(); i > 0; i--) {
+        pattern.push(half[i - 1]);
     }
 
-    // create the final pattern array and append the second half pattern
-    std::vector<CRGB> pattern = patternFirstHalf;
-    pattern.insert(pattern.end(), patternSecondHalf.begin(), patternSecondHalf.end());
+    std::copy(pattern.begin(), pattern.end(), out);
+}
 
-    EFLed.setEFBar(pattern.data());
+void AnimateSnake::_animatePulse() {
+    EFLed.setEFBar(EFLedFrameCache.get(
+        &renderPulse,
+        this->globals->animSnakeHueIdx,
+        ANIMATE_PULSE_PERIOD,
+        EFLED_EFBAR_NUM,
+        this->tick
+    ));
 }
 
 void AnimateSnake::_animateRandom() {
@@ -206,17 +237,15 @@ void AnimateSnake::_animateRandom() {
         randomLightList[random(0, EFLED_TOTAL_NUM-1)] = 255;
     }
 
-    std::vector<CRGB> pattern;
+    CRGB pattern[EFLED_TOTAL_NUM];
 
     // loop through all LED brighnesses and set it. Subtract it afterward to slowly dim them
-    for(int & i : randomLightList) {
-        CHSV color = hueList[this->globals->animSnakeHueIdx];
-        color.value = i;
-        pattern.insert(pattern.end(), color);
-        i -= 20;
-        if(i < 0) { i = 0; };
+    for (uint8_t i = 0; i < EFLED_TOTAL_NUM; i++) {
+        pattern[i] = (*this->ramp)[randomLightList[i]];
+        randomLightList[i] -= 20;
+        if (randomLightList[i] < 0) { randomLightList[i] = 0; };
     }
 
 
-    EFLed.setAll(pattern.data());
+    EFLed.setAll(pattern);
 }
\ No newline at end of file
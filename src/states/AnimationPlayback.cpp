@@ -0,0 +1,124 @@
+// MIT License
+//
+// Copyright 2024 Eurofurence e.V. 
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a
+// copy of this software and associated documentation files (the “Software”),
+// to deal in the Software without restriction, including without limitation
+// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the
+// Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+
+#include <EFLed.h>
+#include <EFLedAnimation.h>
+#include <EFLogging.h>
+
+#include "FSMState.h"
+
+/**
+ * @brief Tick rate used if no animation could be loaded
+ */
+#define ANIMATION_PLAYBACK_IDLE_TICKRATE_MS 500
+
+const char* AnimationPlayback::getName() {
+    return "AnimationPlayback";
+}
+
+bool AnimationPlayback::shouldBeRemembered() {
+    return true;
+}
+
+const unsigned int AnimationPlayback::getTickRateMs() {
+    if (!this->animation.isOpen() || this->animation.getFrameMs() == 0) {
+        return ANIMATION_PLAYBACK_IDLE_TICKRATE_MS;
+    }
+
+    return this->animation.getFrameMs();
+}
+
+void AnimationPlayback::entry() {
+    EFLedAnimationStore.begin();
+    this->_load();
+}
+
+void AnimationPlayback::run() {
+    if (!this->animation.isOpen()) {
+        return;
+    }
+
+    if (!this->animation.nextFrame(this->frame)) {
+        LOGF_ERROR("(AnimationPlayback) Corrupt frame %d. Stopping playback.\r\n", this->animation.getFrameIdx());
+        this->animation = EFLedAnimation();
+        EFLed.clear();
+        return;
+    }
+
+    EFLed.setAll(this->frame);
+}
+
+FSMStatePtr AnimationPlayback::touchEventFingerprintRelease() {
+    if (this->isLocked() || EFLedAnimationStore.count() == 0) {
+        return nullptr;
+    }
+
+    this->globals->animPlaybackIdx = (this->globals->animPlaybackIdx + 1) % EFLedAnimationStore.count();
+    this->is_globals_dirty = true;
+    this->_load();
+
+    return nullptr;
+}
+
+FSMStatePtr AnimationPlayback::touchEventFingerprintShortpress() {
+    if (this->isLocked()) {
+        return nullptr;
+    }
+
+    return makeState<MenuMain>();
+}
+
+FSMStatePtr AnimationPlayback::touchEventFingerprintLongpress() {
+    return this->touchEventFingerprintShortpress();
+}
+
+FSMStatePtr AnimationPlayback::touchEventAllLongpress() {
+    this->toggleLock();
+    return nullptr;
+}
+
+void AnimationPlayback::_load() {
+    fill_solid(this->frame, EFLED_TOTAL_NUM, CRGB::Black);
+
+    const uint16_t num = EFLedAnimationStore.count();
+    if (num == 0) {
+        LOG_WARNING("(AnimationPlayback) No animations found");
+        this->animation = EFLedAnimation();
+        EFLed.clear();
+        EFLed.setDragonNose(CRGB(40, 0, 0));
+        return;
+    }
+
+    const uint16_t idx = this->globals->animPlaybackIdx % num;
+    if (!EFLedAnimationStore.open(idx, this->animation) || this->animation.getNumLeds() != EFLED_TOTAL_NUM) {
+        LOGF_ERROR("(AnimationPlayback) Animation %d is not playable\r\n", idx);
+        this->animation = EFLedAnimation();
+        EFLed.clear();
+        return;
+    }
+
+    LOGF_INFO(
+        "(AnimationPlayback) Playing animation %d: %.16s\r\n",
+        idx,
+        this->animation.getName()
+    );
+}
@@ -25,28 +25,74 @@
  */
 
 #include <EFLed.h>
+#include <EFLedTimeline.h>
 #include <EFLogging.h>
 #include <CustomPatterns.h>
-#include <EFPrideFlags.h>
-#include <cmath>
 
 #include "FSMState.h"
 
 #define ANIMATE_CUSTOM_NUM_TOTAL 4  //!< Number of available animations
 
 /**
- * @brief Index of all animations, each consisting of a periodically called
- * animation function and an associated tick rate in milliseconds.
+ * @brief Static EFBar with rotating dragon head
+ */
+static const EFLedTrack tracks_rotating_dragon_head[] = {
+    {.region = EFLED_REGION_DRAGON, .step_ms = 200, .hold_ms = 0, .fade = 128, .flags = EFLED_TRACK_BLEND},
+    {.region = EFLED_REGION_EFBAR, .step_ms = 0, .hold_ms = 0, .fade = 0, .flags = 0},
+};
+static const EFLedKeyframe keyframes_rotating_dragon_head[] = {
+    {.duration_ms = 0, .palette = CustomPatterns::CircularDragonHead, .palette_len = EFLED_EFBAR_NUM},
+};
+
+/**
+ * @brief Rotating all LEDs
+ */
+static const EFLedTrack tracks_rotating_full[] = {
+    {.region = EFLED_REGION_ALL, .step_ms = 200, .hold_ms = 0, .fade = 128, .flags = EFLED_TRACK_BLEND},
+};
+static const EFLedKeyframe keyframes_rotating_full[] = {
+    {.duration_ms = 0, .palette = CustomPatterns::CircularFull, .palette_len = EFLED_TOTAL_NUM},
+};
+
+/**
+ * @brief Random colors rotating through the dragon head. The EFBar picks up
+ * the current colors every few seconds.
+ */
+static const EFLedTrack tracks_random[] = {
+    {.region = EFLED_REGION_DRAGON, .step_ms = 2000, .hold_ms = 0, .fade = 128, .flags = EFLED_TRACK_BLEND},
+    {.region = EFLED_REGION_EFBAR, .step_ms = 0, .hold_ms = 5000, .fade = 0, .flags = 0},
+};
+static const EFLedKeyframe keyframes_random[] = {
+    {.duration_ms = 0, .palette = nullptr, .palette_len = EFLED_EFBAR_NUM},
+};
+
+#define CUSTOM_PATTERNS_TIMELINE(name, random) { \
+    .tracks = tracks_##name, \
+    .num_tracks = sizeof(tracks_##name) / sizeof(EFLedTrack), \
+    .keyframes = keyframes_##name, \
+    .num_keyframes = sizeof(keyframes_##name) / sizeof(EFLedKeyframe), \
+    .random_ms = random \
+}
+
+static const EFLedTimeline timeline_rotating_dragon_head = CUSTOM_PATTERNS_TIMELINE(rotating_dragon_head, 0);
+static const EFLedTimeline timeline_rotating_full = CUSTOM_PATTERNS_TIMELINE(rotating_full, 0);
+static const EFLedTimeline timeline_random = CUSTOM_PATTERNS_TIMELINE(random, 200);
+
+/**
+ * @brief Index of all animations, each consisting of either a timeline or a
+ * periodically called animation function, and an associated tick rate in
+ * milliseconds. Timelines depend on the elapsed time only and may therefore be
+ * run less often while their frames barely change, see getMaxTickRateMs().
  */ 
 const struct {
+    const EFLedTimeline* timeline;
     void (CustomPatternsDisplay::* animate)();
     const unsigned int tickrate;
 } animations[ANIMATE_CUSTOM_NUM_TOTAL] = {
-//    {.animate = &CustomPatternsDisplay::_staticPattern, .tickrate = 20},
-    {.animate = &CustomPatternsDisplay::_rotatingDragonHead, .tickrate = 20},
-    {.animate = &CustomPatternsDisplay::_rotatingFull, .tickrate = 20},
-    {.animate = &CustomPatternsDisplay::_starlight, .tickrate = 20},
-    {.animate = &CustomPatternsDisplay::_randomPattern, .tickrate = 200},
+    {.timeline = &timeline_rotating_dragon_head, .animate = nullptr, .tickrate = 20},
+    {.timeline = &timeline_rotating_full, .animate = nullptr, .tickrate = 20},
+    {.timeline = nullptr, .animate = &CustomPatternsDisplay::_starlight, .tickrate = 20},
+    {.timeline = &timeline_random, .animate = nullptr, .tickrate = 200},
 };
 
 const char* CustomPatternsDisplay::getName() {
@@ -62,29 +108,45 @@ const unsigned int CustomPatternsDisplay::getTickRateMs() {
     return 20;
 }
 
+const unsigned int CustomPatternsDisplay::getMaxTickRateMs() {
+    const auto& animation = animations[this->globals->cstPatternsIdx % ANIMATE_CUSTOM_NUM_TOTAL];
+    if (!animation.timeline) {
+        return animation.tickrate;
+    }
+    return EFLedTimelinePlayer::getMaxSampleIntervalMs(*animation.timeline);
+}
+
 void CustomPatternsDisplay::entry() {
-    this->switchdelay_ms = 5000;
     this->tick = 0;
+    this->start_ms = millis();
+    this->seed = random();
 }
 
 void CustomPatternsDisplay::run() {
-    (*this.*(animations[this->globals->cstPatternsIdx % ANIMATE_CUSTOM_NUM_TOTAL].animate))();
+    const auto& animation = animations[this->globals->cstPatternsIdx % ANIMATE_CUSTOM_NUM_TOTAL];
+    if (animation.timeline) {
+        CRGB data[EFLED_TOTAL_NUM];
+        EFLedTimelinePlayer::render(*animation.timeline, millis() - this->start_ms, this->seed, data);
+        EFLed.setAll(data);
+    } else {
+        (*this.*(animation.animate))();
+    }
     this->tick++;
 }
 
-std::unique_ptr<FSMState> CustomPatternsDisplay::touchEventFingerprintShortpress() {
+FSMStatePtr CustomPatternsDisplay::touchEventFingerprintShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    return std::make_unique<MenuMain>();
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> CustomPatternsDisplay::touchEventFingerprintLongpress() {
+FSMStatePtr CustomPatternsDisplay::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
-std::unique_ptr<FSMState> CustomPatternsDisplay::touchEventFingerprintRelease() {
+FSMStatePtr CustomPatternsDisplay::touchEventFingerprintRelease() {
     if (this->isLocked()) {
         return nullptr;
     }
@@ -92,6 +154,7 @@ std::unique_ptr<FSMState> CustomPatternsDisplay::touchEventFingerprintRelease()
     this->globals->cstPatternsIdx = (this->globals->cstPatternsIdx + 1) %  ANIMATE_CUSTOM_NUM_TOTAL;
     this->is_globals_dirty = true;
     this->tick = 0;
+    this->start_ms = millis();
     EFLed.clear();
 
     LOGF_INFO(
@@ -102,74 +165,11 @@ std::unique_ptr<FSMState> CustomPatternsDisplay::touchEventFingerprintRelease()
     return nullptr;
 }
 
-std::unique_ptr<FSMState> CustomPatternsDisplay::touchEventAllLongpress() {
+FSMStatePtr CustomPatternsDisplay::touchEventAllLongpress() {
     this->toggleLock();
     return nullptr;
 }
 
-/**
- * @brief Static EFBar with rotating dragon head
- */
-void CustomPatternsDisplay::_rotatingDragonHead() {
-    // Determine colors to show
-    const CRGB* customPatternsColor = CustomPatterns::CircularDragonHead;
-    
-    // Animate dragon: Rotate color palette to cycle through dragon head
-    std::vector<CRGB> rotatedflag(customPatternsColor, customPatternsColor + EFLED_EFBAR_NUM);
-    std::rotate(rotatedflag.begin(), rotatedflag.begin() + (this->tick % (EFLED_EFBAR_NUM*20)) / 20, rotatedflag.end());
-
-    // Animate dragon: Create current and next dragon head patterns
-    CRGB dragon[EFLED_DRAGON_NUM];
-    CRGB dragon_next[EFLED_DRAGON_NUM];
-    std::copy(rotatedflag.begin(), rotatedflag.begin() + EFLED_DRAGON_NUM, dragon);
-    std::copy(rotatedflag.begin() + 1, rotatedflag.begin() + 1 + EFLED_DRAGON_NUM, dragon_next);
-
-    // Animate dragon: Blend both patterns based on current tick and reduce brightness
-    CRGB dragon_now[EFLED_DRAGON_NUM];
-    blend(dragon, dragon_next, dragon_now, EFLED_DRAGON_NUM, ((this->tick % 20) / 20.0) * 255);
-    fadeLightBy(dragon_now, EFLED_DRAGON_NUM, 128);
-
-    // Animate dragon: Finally show it!
-    EFLed.setDragon(dragon_now);
-
-    // Refresh periodically
-    if (this->tick % (this->switchdelay_ms / this->getTickRateMs()) == 0) {
-        EFLed.setEFBar(customPatternsColor);
-    }
-
-    // Prepare next tick
-    this->tick++;
-}
-
-/**
- * @brief Rotating all LEDs
- */
-void CustomPatternsDisplay::_rotatingFull() {
-    // Determine colors to show
-    const CRGB* customPatternsColor = CustomPatterns::CircularFull;
-
-    // Animate dragon: Rotate color palette to cycle through
-    std::vector<CRGB> rotatedflag(customPatternsColor, customPatternsColor + EFLED_TOTAL_NUM);
-    std::rotate(rotatedflag.begin(), rotatedflag.begin() + (this->tick % (EFLED_TOTAL_NUM*20)) / 20, rotatedflag.end());
-
-    // Animate dragon: Create current and next patterns
-    CRGB leds[EFLED_TOTAL_NUM];
-    CRGB leds_next[EFLED_TOTAL_NUM];
-    std::copy(rotatedflag.begin(), rotatedflag.begin() + EFLED_TOTAL_NUM, leds);
-    std::copy(rotatedflag.begin() + 1, rotatedflag.begin() + 1 + EFLED_TOTAL_NUM, leds_next);
-
-    // Animate dragon: Blend both patterns based on current tick and reduce brightness
-    CRGB leds_now[EFLED_TOTAL_NUM];
-    blend(leds, leds_next, leds_now, EFLED_TOTAL_NUM, ((this->tick % 20) / 20.0) * 255);
-    fadeLightBy(leds_now, EFLED_TOTAL_NUM, 128);
-
-    // Animate: Finally show it!
-    EFLed.setAll(leds_now);
-
-    // Prepare next tick
-    this->tick++;
-}
-
 /**
  * @brief Stars effect
  */
@@ -226,51 +226,3 @@ void CustomPatternsDisplay::_starlight() {
     // Prepare next tick
     this->tick++;
 }
-
-
-/**
- * @brief Starlight effect
- */
-void CustomPatternsDisplay::_randomPattern() {
-    const CRGB Random[] = {
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-        CHSV(random(0, 255), 255, 255),
-    };
-
-    const CRGB* prideFlag = Random;
-
-    // Animate dragon: Rotate current flag to cycle through dragon head
-    std::vector<CRGB> rotatedflag(prideFlag, prideFlag + EFLED_EFBAR_NUM);
-    std::rotate(rotatedflag.begin(), rotatedflag.begin() + (this->tick % (EFLED_EFBAR_NUM*20)) / 20, rotatedflag.end());
-
-    // Animate dragon: Create current and next dragon head patterns
-    CRGB dragon[EFLED_DRAGON_NUM];
-    CRGB dragon_next[EFLED_DRAGON_NUM];
-    std::copy(rotatedflag.begin(), rotatedflag.begin() + EFLED_DRAGON_NUM, dragon);
-    std::copy(rotatedflag.begin() + 1, rotatedflag.begin() + 1 + EFLED_DRAGON_NUM, dragon_next);
-
-    // Animate dragon: Blend both patterns based on current tick and reduce brightness
-    CRGB dragon_now[EFLED_DRAGON_NUM];
-    blend(dragon, dragon_next, dragon_now, EFLED_DRAGON_NUM, ((this->tick % 20) / 20.0) * 255);
-    fadeLightBy(dragon_now, EFLED_DRAGON_NUM, 128);
-
-    // Animate dragon: Finally show it!
-    EFLed.setDragon(dragon_now);
-
-    // Refresh flag periodically
-    if (this->tick % (this->switchdelay_ms / this->getTickRateMs()) == 0) {
-        EFLed.setEFBar(prideFlag);
-    }
-
-    // Prepare next tick
-    this->tick++;
-}
\ No newline at end of file
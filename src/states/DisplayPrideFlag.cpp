@@ -25,12 +25,79 @@
  */
 
 #include <EFLed.h>
+#include <EFLedTimeline.h>
 #include <EFLogging.h>
 #include <EFPrideFlags.h>
-#include <vector>
 
 #include "FSMState.h"
 
+#define PRIDE_FLAG_NUM_MODES 13  //!< Cycle through all flags + one mode per flag
+#define PRIDE_FLAG_SWITCH_MS 5000  //!< Time each flag is shown while cycling
+
+/**
+ * @brief Dragon head slowly rotates through the flag colors while the EFBar shows the flag
+ */
+static const EFLedTrack tracks[] = {
+    {.region = EFLED_REGION_DRAGON, .step_ms = 400, .hold_ms = 0, .fade = 128, .flags = EFLED_TRACK_BLEND},
+    {.region = EFLED_REGION_EFBAR, .step_ms = 0, .hold_ms = 0, .fade = 0, .flags = 0},
+};
+
+#define PRIDE_FLAG_KEYFRAME(flag, duration) {.duration_ms = duration, .palette = flag, .palette_len = EFLED_EFBAR_NUM}
+
+static const EFLedKeyframe keyframes_cycle[] = {
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::LGBT, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Bisexual, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Polyamorous, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Polysexual, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Transgender, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Pansexual, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Asexual, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Genderfluid, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Genderqueer, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Nonbinary, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Intersex, PRIDE_FLAG_SWITCH_MS),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::LGBTQI, PRIDE_FLAG_SWITCH_MS),
+};
+
+/**
+ * @brief Static flags, one per mode
+ */
+static const EFLedKeyframe keyframes_static[] = {
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::LGBT, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::LGBTQI, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Bisexual, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Polyamorous, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Polysexual, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Transgender, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Pansexual, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Asexual, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Genderfluid, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Genderqueer, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Nonbinary, 0),
+    PRIDE_FLAG_KEYFRAME(EFPrideFlags::Intersex, 0),
+};
+
+#define PRIDE_FLAG_STATIC_TIMELINE(idx) {.tracks = tracks, .num_tracks = 2, .keyframes = &keyframes_static[idx], .num_keyframes = 1, .random_ms = 0}
+
+/**
+ * @brief Timelines for all modes, indexed by prideFlagModeIdx
+ */
+static const EFLedTimeline timelines[PRIDE_FLAG_NUM_MODES] = {
+    {.tracks = tracks, .num_tracks = 2, .keyframes = keyframes_cycle, .num_keyframes = 12, .random_ms = 0},
+    PRIDE_FLAG_STATIC_TIMELINE(0),
+    PRIDE_FLAG_STATIC_TIMELINE(1),
+    PRIDE_FLAG_STATIC_TIMELINE(2),
+    PRIDE_FLAG_STATIC_TIMELINE(3),
+    PRIDE_FLAG_STATIC_TIMELINE(4),
+    PRIDE_FLAG_STATIC_TIMELINE(5),
+    PRIDE_FLAG_STATIC_TIMELINE(6),
+    PRIDE_FLAG_STATIC_TIMELINE(7),
+    PRIDE_FLAG_STATIC_TIMELINE(8),
+    PRIDE_FLAG_STATIC_TIMELINE(9),
+    PRIDE_FLAG_STATIC_TIMELINE(10),
+    PRIDE_FLAG_STATIC_TIMELINE(11),
+};
+
 const char* DisplayPrideFlag::getName() {
     return "DisplayPrideFlag";
 }
@@ -43,111 +110,56 @@ const unsigned int DisplayPrideFlag::getTickRateMs() {
     return 20;
 }
 
+const unsigned int DisplayPrideFlag::getMaxTickRateMs() {
+    // The dragon head blends through the flag in every mode
+    return EFLedTimelinePlayer::getMaxSampleIntervalMs(timelines[this->globals->prideFlagModeIdx % PRIDE_FLAG_NUM_MODES]);
+}
+
 void DisplayPrideFlag::entry() {
-    this->switchdelay_ms = 5000;
-    this->tick = 0;
+    this->start_ms = millis();
 }
 
 void DisplayPrideFlag::run() {
-    // Check if we need to switch the flag (Mode: 0)
-    if (this->tick % (this->switchdelay_ms / this->getTickRateMs()) == 0) {
-        if (this->globals->prideFlagModeIdx == 0) {
-            // Cycle through all flags
-            LOGF_DEBUG("(DisplayPrideFlag) Switched pride flag to: %d\r\n", flagidx);
-            flagidx = (flagidx + 1) % 12;
-        }
-    }
-
-    // Determine pride flag to show
-    const CRGB* prideFlag = EFPrideFlags::LGBTQI;
-    if (this->globals->prideFlagModeIdx == 0) {
-        switch (flagidx) {
-            case 0: prideFlag = EFPrideFlags::LGBTQI; break;
-            case 1: prideFlag = EFPrideFlags::LGBT; break;
-            case 2: prideFlag = EFPrideFlags::Bisexual; break;
-            case 3: prideFlag = EFPrideFlags::Polyamorous; break;
-            case 4: prideFlag = EFPrideFlags::Polysexual; break;
-            case 5: prideFlag = EFPrideFlags::Transgender; break;
-            case 6: prideFlag = EFPrideFlags::Pansexual; break;
-            case 7: prideFlag = EFPrideFlags::Asexual; break;
-            case 8: prideFlag = EFPrideFlags::Genderfluid; break;
-            case 9: prideFlag = EFPrideFlags::Genderqueer; break;
-            case 10: prideFlag = EFPrideFlags::Nonbinary; break;
-            case 11: prideFlag = EFPrideFlags::Intersex; break;
-        }
-    } else {
-        switch(this->globals->prideFlagModeIdx) {
-            // Static flags
-            case 1: prideFlag = EFPrideFlags::LGBT; break;
-            case 2: prideFlag = EFPrideFlags::LGBTQI; break;
-            case 3: prideFlag = EFPrideFlags::Bisexual; break;
-            case 4: prideFlag = EFPrideFlags::Polyamorous; break;
-            case 5: prideFlag = EFPrideFlags::Polysexual; break;
-            case 6: prideFlag = EFPrideFlags::Transgender; break;
-            case 7: prideFlag = EFPrideFlags::Pansexual; break;
-            case 8: prideFlag = EFPrideFlags::Asexual; break;
-            case 9: prideFlag = EFPrideFlags::Genderfluid; break;
-            case 10: prideFlag = EFPrideFlags::Genderqueer; break;
-            case 11: prideFlag = EFPrideFlags::Nonbinary; break;
-            case 12: prideFlag = EFPrideFlags::Intersex; break;
-            default:
-                LOG_ERROR("(DisplayPrideFlag) Invalid prideFlagModeIdx!")
-                break;
-        }
-    }
-    
-    // Animate dragon: Rotate current flag to cycle through dragon head
-    std::vector<CRGB> rotatedflag(prideFlag, prideFlag + EFLED_EFBAR_NUM);
-    std::rotate(rotatedflag.begin(), rotatedflag.begin() + (this->tick % (EFLED_EFBAR_NUM*20)) / 20, rotatedflag.end());
-
-    // Animate dragon: Create current and next dragon head patterns
-    CRGB dragon[EFLED_DRAGON_NUM];
-    CRGB dragon_next[EFLED_DRAGON_NUM];
-    std::copy(rotatedflag.begin(), rotatedflag.begin() + EFLED_DRAGON_NUM, dragon);
-    std::copy(rotatedflag.begin() + 1, rotatedflag.begin() + 1 + EFLED_DRAGON_NUM, dragon_next);
-
-    // Animate dragon: Blend both patterns based on current tick and reduce brightness
-    CRGB dragon_now[EFLED_DRAGON_NUM];
-    blend(dragon, dragon_next, dragon_now, EFLED_DRAGON_NUM, ((this->tick % 20) / 20.0) * 255);
-    fadeLightBy(dragon_now, EFLED_DRAGON_NUM, 128);
-
-    // Animate dragon: Finally show it!
-    EFLed.setDragon(dragon_now);
-
-    // Refresh flag periodically
-    if (this->tick % (this->switchdelay_ms / this->getTickRateMs()) == 0) {
-        EFLed.setEFBar(prideFlag);
+    if (this->globals->prideFlagModeIdx >= PRIDE_FLAG_NUM_MODES) {
+        LOG_ERROR("(DisplayPrideFlag) Invalid prideFlagModeIdx!")
+        return;
     }
 
-    // Prepare next tick
-    this->tick++;
+    CRGB data[EFLED_TOTAL_NUM];
+    EFLedTimelinePlayer::render(
+        timelines[this->globals->prideFlagModeIdx],
+        millis() - this->start_ms,
+        0,
+        data
+    );
+    EFLed.setAll(data);
 }
 
-std::unique_ptr<FSMState> DisplayPrideFlag::touchEventFingerprintShortpress() {
+FSMStatePtr DisplayPrideFlag::touchEventFingerprintShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    return std::make_unique<MenuMain>();
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> DisplayPrideFlag::touchEventFingerprintLongpress() {
+FSMStatePtr DisplayPrideFlag::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
-std::unique_ptr<FSMState> DisplayPrideFlag::touchEventFingerprintRelease() {
+FSMStatePtr DisplayPrideFlag::touchEventFingerprintRelease() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    this->globals->prideFlagModeIdx = (this->globals->prideFlagModeIdx + 1) % 13;
+    this->globals->prideFlagModeIdx = (this->globals->prideFlagModeIdx + 1) % PRIDE_FLAG_NUM_MODES;
     this->is_globals_dirty = true;
-    this->tick = 0;
+    this->start_ms = millis();
 
     return nullptr;
 }
 
-std::unique_ptr<FSMState> DisplayPrideFlag::touchEventAllLongpress() {
+FSMStatePtr DisplayPrideFlag::touchEventAllLongpress() {
     this->toggleLock();
     return nullptr;
 }
@@ -25,10 +25,47 @@
  */
 
 #include <EFLed.h>
+#include <EFLedEffects.h>
 #include <EFLogging.h>
 
 #include "FSMState.h"
 
+alignas(FSMStateArena::SLOT_ALIGN) static uint8_t fsm_state_slots[FSM_STATE_ARENA_SLOTS][FSMStateArena::SLOT_SIZE];
+static bool fsm_state_slots_used[FSM_STATE_ARENA_SLOTS];
+
+void* FSMStateArena::acquire() {
+    for (uint8_t i = 0; i < FSM_STATE_ARENA_SLOTS; i++) {
+        if (!fsm_state_slots_used[i]) {
+            fsm_state_slots_used[i] = true;
+            return fsm_state_slots[i];
+        }
+    }
+
+    LOG_ERROR("(FSM) No free state slot left. Too many states alive.");
+    return nullptr;
+}
+
+void FSMStateArena::release(void* slot) {
+    for (uint8_t i = 0; i < FSM_STATE_ARENA_SLOTS; i++) {
+        if (slot == fsm_state_slots[i]) {
+            fsm_state_slots_used[i] = false;
+            return;
+        }
+    }
+}
+
+uint8_t FSMStateArena::getUsedSlots() {
+    uint8_t num = 0;
+    for (uint8_t i = 0; i < FSM_STATE_ARENA_SLOTS; i++) {
+        num += fsm_state_slots_used[i];
+    }
+    return num;
+}
+
+void FSMStateDeleter::operator()(FSMState* state) const {
+    state->~FSMState();
+    FSMStateArena::release(state);
+}
 
 void FSMState::attachGlobals(std::shared_ptr<FSMGlobals> globals) {
     this->globals = std::move(globals);
@@ -46,23 +83,13 @@ void FSMState::lock() {
     this->is_locked = true;
     LOG_INFO("(FSM) Locked current state");
 
-    for (uint8_t i = 0; i < 3; i ++) {
-        EFLed.setDragonEye(CRGB::Red);
-        delay(200);
-        EFLed.setDragonEye(CRGB::Black);
-        delay(200);
-    }
+    EFLedEffects.pushBlink({EFLED_DRAGON_EYE_IDX, 1}, CRGB::Red, 3, 200, 200);
 }
 
 void FSMState::unlock() {
     this->is_locked = false;
 
-    for (uint8_t i = 0; i < 3; i ++) {
-        EFLed.setDragonEye(CRGB::Green);
-        delay(200);
-        EFLed.setDragonEye(CRGB::Black);
-        delay(200);
-    }
+    EFLedEffects.pushBlink({EFLED_DRAGON_EYE_IDX, 1}, CRGB::Green, 3, 200, 200);
 
     LOG_INFO("(FSM) Unlocked current state")
 }
@@ -91,48 +118,52 @@ const unsigned int FSMState::getTickRateMs() {
     return 0;
 }
 
+const unsigned int FSMState::getMaxTickRateMs() {
+    return this->getTickRateMs();
+}
+
 void FSMState::entry() {}
 
 void FSMState::run() {}
 
 void FSMState::exit() {}
 
-std::unique_ptr<FSMState> FSMState::touchEventFingerprintTouch() {
+FSMStatePtr FSMState::touchEventFingerprintTouch() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventFingerprintRelease() {
+FSMStatePtr FSMState::touchEventFingerprintRelease() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventFingerprintShortpress() {
+FSMStatePtr FSMState::touchEventFingerprintShortpress() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventFingerprintLongpress() {
+FSMStatePtr FSMState::touchEventFingerprintLongpress() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventNoseTouch() {
+FSMStatePtr FSMState::touchEventNoseTouch() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventNoseRelease() {
+FSMStatePtr FSMState::touchEventNoseRelease() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventNoseShortpress() {
+FSMStatePtr FSMState::touchEventNoseShortpress() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventNoseLongpress() {
+FSMStatePtr FSMState::touchEventNoseLongpress() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventAllShortpress() {
+FSMStatePtr FSMState::touchEventAllShortpress() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> FSMState::touchEventAllLongpress() {
+FSMStatePtr FSMState::touchEventAllLongpress() {
     return nullptr;
 }
@@ -24,6 +24,8 @@
  * @author 32
  */
 
+#include <EFEnergy.h>
+#include <EFHeap.h>
 #include <EFLed.h>
 #include <EFLogging.h>
 #include "FSMState.h"
@@ -48,7 +50,7 @@ painlessMesh mesh;
 
 uint8_t rainbow[] = {1,24,47,72,96,116,140,164,186,210,232};
 
-std::vector<CRGB> bar = {
+CRGB bar[EFLED_EFBAR_NUM] = {
   CHSV(rainbow[0], 255, 255),
   CHSV(rainbow[1], 255, 255),
   CHSV(rainbow[2], 255, 255),
@@ -174,6 +176,7 @@ void GameHuemesh::entry() {
 
 	// The transmit power can be set from 8 (lowest power ~7dBm) to 84 (highest power 20dBm) (value is in units of 0.25 dBm)
 	//String ssid, String password, uint16_t port = 5555, WiFiMode_t connectMode = WIFI_AP_STA, uint8_t channel = 1, uint8_t hidden = 0, uint8_t maxconn = 4
+	EFEnergy.setRadioActive(true);
 	mesh.init(MESH_PREFIX, MESH_PASSWORD, &userScheduler, MESH_PORT, WIFI_AP_STA, 1, 0, 6);
 	mesh.onReceive(&incomingDataCallback);
 	mesh.onNewConnection(&newConnectionCallback);
@@ -193,22 +196,26 @@ void GameHuemesh::exit() {
 }
 
 void GameHuemesh::run() {
-	mesh.update();
-
-	std::vector<CRGB> dragon = {
-	  CHSV(rainbow[own_hue], 255, 255),
-	  CHSV(rainbow[own_hue], 255, 169),
-	  CHSV(rainbow[own_hue], 255, 124),
-	  CHSV(rainbow[own_hue], 255, 100),
-	  CRGB::Black,
-	  CRGB::Black
-	};
-	
+	{
+		// painlessMesh allocates for every received message by design
+		EFHeapUntrackedScope untracked;
+		mesh.update();
+	}
+
+	CRGB dragon[EFLED_DRAGON_NUM];
 	if(edit_happen < 12){
-		std::rotate(dragon.begin(), dragon.begin() + this->tick % EFLED_DRAGON_NUM, dragon.end());
+		const CRGB running[EFLED_DRAGON_NUM] = {
+			CHSV(rainbow[own_hue], 255, 255),
+			CHSV(rainbow[own_hue], 255, 169),
+			CHSV(rainbow[own_hue], 255, 124),
+			CHSV(rainbow[own_hue], 255, 100),
+			CRGB::Black,
+			CRGB::Black
+		};
+		std::rotate_copy(running, running + this->tick % EFLED_DRAGON_NUM, running + EFLED_DRAGON_NUM, dragon);
 		edit_happen++;
 	} else {
-		dragon = {
+		const CRGB idle[EFLED_DRAGON_NUM] = {
 			CHSV(rainbow[own_hue], 255, 255),
 			CHSV(rainbow[own_hue], 255, 100),
 			CHSV(rainbow[own_hue], 255, 255),
@@ -216,6 +223,7 @@ void GameHuemesh::run() {
 			CRGB::Black,
 			CRGB::Black
 		};
+		std::copy(idle, idle + EFLED_DRAGON_NUM, dragon);
 	}
 	
 	/*
@@ -225,25 +233,25 @@ void GameHuemesh::run() {
 	}
 	*/
 
-	dragon.insert(dragon.end(), bar.begin(), bar.end());
-	EFLed.setAll(dragon.data());
+	EFLed.setDragon(dragon);
+	EFLed.setEFBar(bar);
 
 	this->tick++;
 }
 
 
-std::unique_ptr<FSMState> GameHuemesh::touchEventFingerprintShortpress() {
+FSMStatePtr GameHuemesh::touchEventFingerprintShortpress() {
 	if (this->isLocked()) {
 		return nullptr;
 	}
 	return nullptr;
 }
 
-std::unique_ptr<FSMState> GameHuemesh::touchEventFingerprintLongpress() {
-	return std::make_unique<MenuMain>();
+FSMStatePtr GameHuemesh::touchEventFingerprintLongpress() {
+	return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> GameHuemesh::touchEventFingerprintRelease() {
+FSMStatePtr GameHuemesh::touchEventFingerprintRelease() {
 	if (this->isLocked()) {
 		return nullptr;
 	}
@@ -256,15 +264,15 @@ std::unique_ptr<FSMState> GameHuemesh::touchEventFingerprintRelease() {
 	return nullptr;
 }
 
-std::unique_ptr<FSMState> GameHuemesh::touchEventNoseShortpress() {
+FSMStatePtr GameHuemesh::touchEventNoseShortpress() {
 	return nullptr;
 }
 
-std::unique_ptr<FSMState> GameHuemesh::touchEventNoseLongpress() {
+FSMStatePtr GameHuemesh::touchEventNoseLongpress() {
 	return nullptr;
 }
 
-std::unique_ptr<FSMState> GameHuemesh::touchEventNoseRelease() {
+FSMStatePtr GameHuemesh::touchEventNoseRelease() {
 	//Subtract 1 from all others
 	for(int i=0; i < NUM_HUES; i++){
 		if(hue_consensus[i] > 1 && i != own_hue) hue_consensus[i]--;
@@ -281,7 +289,7 @@ std::unique_ptr<FSMState> GameHuemesh::touchEventNoseRelease() {
 }
 
 
-std::unique_ptr<FSMState> GameHuemesh::touchEventAllLongpress() {
+FSMStatePtr GameHuemesh::touchEventAllLongpress() {
 	this->toggleLock();
 	return nullptr;
 }
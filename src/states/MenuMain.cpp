@@ -25,6 +25,7 @@
  */
 
 #include <EFLed.h>
+#include <EFLedEffects.h>
 #include <EFLogging.h>
 
 #include "FSMState.h"
@@ -32,7 +33,7 @@
 /**
  * @brief Number of registered menu items
  */
-#define MENUMAIN_NUM_MENU_ITEMS 9
+#define MENUMAIN_NUM_MENU_ITEMS 10
 
 CRGB menuColors[11] = {
     CRGB(40,10,10),
@@ -56,6 +57,7 @@ const unsigned int MenuMain::getTickRateMs() {
 }
 
 void MenuMain::entry() {
+    EFLedFrameGuard frame(EFLed);
     EFLed.clear();
     EFLed.setDragonCheek(CRGB::Green);
     EFLed.setEFBarCursor(this->globals->menuMainPointerIdx, CRGB::Silver, CRGB::Black);
@@ -73,37 +75,52 @@ void MenuMain::exit() {
     EFLed.clear();
 }
 
-std::unique_ptr<FSMState> MenuMain::touchEventFingerprintRelease() {
+FSMStatePtr MenuMain::touchEventFingerprintRelease() {
     this->globals->menuMainPointerIdx = (this->globals->menuMainPointerIdx + 1) % MENUMAIN_NUM_MENU_ITEMS;
     EFLed.setEFBarCursor(this->globals->menuMainPointerIdx, CRGB::Purple, menuColors[this->globals->menuMainPointerIdx]);
     return nullptr;
 }
 
-std::unique_ptr<FSMState> MenuMain::touchEventFingerprintShortpress() {
+FSMStatePtr MenuMain::touchEventFingerprintShortpress() {
     LOGF_DEBUG("(MenuMain) menuMainPointerIdx = %d\r\n", this->globals->menuMainPointerIdx);
     switch (this->globals->menuMainPointerIdx) {
         // NOTE: Increase MENUMAIN_NUM_MENU_ITEMS define at the top of this file
-        case 0: return std::make_unique<DisplayPrideFlag>();
-        case 1: return std::make_unique<AnimateRainbow>();
-        case 2: return std::make_unique<AnimateMatrix>();
-        case 3: return std::make_unique<AnimateSnake>();
-        case 4: return std::make_unique<AnimateHeartbeat>();
-//      case 5: return std::make_unique<OTAUpdate>(); // OTA Update not in production firmware
-//		case 6: return std::make_unique<GameHuemesh>(); //Game :3
-//		case 7: return std::make_unique<VUMeter>(); //VUMeter :3
-        case 8: return std::make_unique<CustomPatternsDisplay>();
+        case 0: return makeState<DisplayPrideFlag>();
+        case 1: return makeState<AnimateRainbow>();
+        case 2: return makeState<AnimateMatrix>();
+        case 3: return makeState<AnimateSnake>();
+        case 4: return makeState<AnimateHeartbeat>();
+//      case 5: return makeState<OTAUpdate>(); // OTA Update not in production firmware
+//		case 6: return makeState<GameHuemesh>(); //Game :3
+//		case 7: return makeState<VUMeter>(); //VUMeter :3
+        case 8: return makeState<CustomPatternsDisplay>();
+        case 9: return makeState<AnimationPlayback>();
         default: return nullptr;
     }
 }
 
-std::unique_ptr<FSMState> MenuMain::touchEventFingerprintLongpress() {
+FSMStatePtr MenuMain::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
-std::unique_ptr<FSMState> MenuMain::touchEventNoseLongpress() {
-    EFLed.clear();
-    EFLed.setDragonEye(CRGB::White);
+/**
+ * @brief Enqueues a single step of the brightness change animation. Shows the
+ * white dragon eye and the given brightness level on the EF bar.
+ *
+ * @param percent Brightness level to show
+ * @param color Color of the lit EF bar LEDs
+ * @param duration_ms Time to show the step
+ * @param brightness_percent LED brightness to apply, 0 to keep
+ */
+static void pushBrightnessStep(float percent, const CRGB color, uint16_t duration_ms, uint8_t brightness_percent = 0) {
+    CRGB data[EFLED_TOTAL_NUM];
+    fill_solid(data, EFLED_TOTAL_NUM, CRGB::Black);
+    data[EFLED_DRAGON_EYE_IDX] = CRGB::White;
+    fill_solid(data + EFLED_EFBAR_OFFSET, map(percent, 0, 100, 0, EFLED_EFBAR_NUM), color);
+    EFLedEffects.push(EFLED_REGION_ALL, data, duration_ms, brightness_percent);
+}
 
+FSMStatePtr MenuMain::touchEventNoseLongpress() {
     uint8_t currentBrightness = this->globals->ledBrightnessPercent;
     // if we start at 10, it will be 10 -> 40 -> 70 -> 100 -> 10…
     uint8_t newBrightness =  currentBrightness + 30;
@@ -113,33 +130,19 @@ std::unique_ptr<FSMState> MenuMain::touchEventNoseLongpress() {
     }
     LOGF_DEBUG("(MenuMain) Setting brightness percent to %d\r\n", newBrightness);
 
-    // animate to new brightness
-    CRGB data[EFLED_EFBAR_NUM];
-    fill_solid(data, EFLED_EFBAR_NUM, CRGB::Black);
+    // animate to new brightness. A new change replaces a running animation.
+    EFLedEffects.clear();
     float stepSize = (newBrightness - currentBrightness) / 10.0f;
-    fill_solid(data, map(currentBrightness, 0, 100, 0, EFLED_EFBAR_NUM), CRGB(30, 30, 30));
-    EFLed.setEFBar(data);
-    delay(100);
-    fill_solid(data, map(currentBrightness, 0, 100, 0, EFLED_EFBAR_NUM), CRGB(100, 100, 100));
-    EFLed.setEFBar(data);
-    delay(200);
+    pushBrightnessStep(currentBrightness, CRGB(30, 30, 30), 100);
+    pushBrightnessStep(currentBrightness, CRGB(100, 100, 100), 200);
     for(int8_t i = 1; i <= 10; i++) {
         float interpolatedBrightness = currentBrightness + (i * stepSize);
-        EFLed.setBrightnessPercent(interpolatedBrightness);
-        fill_solid(data, EFLED_EFBAR_NUM, CRGB::Black);
-        fill_solid(data, map(interpolatedBrightness, 0, 100, 0, EFLED_EFBAR_NUM), CRGB(100, 100, 100));
-        EFLed.setEFBar(data);
-        delay(40);
+        pushBrightnessStep(interpolatedBrightness, CRGB(100, 100, 100), 40, interpolatedBrightness);
     }
-    fill_solid(data, map(newBrightness, 0, 100, 0, EFLED_EFBAR_NUM), CRGB(100, 100, 100));
-    EFLed.setEFBar(data);
-    delay(400);
+    pushBrightnessStep(newBrightness, CRGB(100, 100, 100), 400, newBrightness);
 
     this->globals->ledBrightnessPercent = newBrightness;
     this->is_globals_dirty = true;
-    EFLed.setBrightnessPercent(this->globals->ledBrightnessPercent);
 
-    // reset view
-    this->entry();
     return nullptr;
 }
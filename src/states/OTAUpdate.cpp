@@ -58,10 +58,10 @@ void OTAUpdate::exit() {
     EFBoard.disableWifi();
 }
 
-std::unique_ptr<FSMState> OTAUpdate::touchEventFingerprintShortpress() {
-    return std::make_unique<MenuMain>();
+FSMStatePtr OTAUpdate::touchEventFingerprintShortpress() {
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> OTAUpdate::touchEventFingerprintLongpress() {
+FSMStatePtr OTAUpdate::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
@@ -25,15 +25,15 @@
  */
 
 #include <EFLed.h>
+#include <EFLedPalette.h>
 #include <EFLogging.h>
 
 #include "FSMState.h"
 
 #define AUDIO_PIN 14
 
-const int hue_list[] = {
-110,110,110,110,110,110,110,110,110,110,110
-};
+#define VUMETER_DRAGON_HUE 0  //!< Hue of the dragon LEDs
+#define VUMETER_BAR_HUE 110   //!< Hue of all EF bar LEDs
 
 const char* VUMeter::getName() {
     return "VUMeter";
@@ -45,6 +45,8 @@ bool VUMeter::shouldBeRemembered() {
 
 void VUMeter::entry() {
     this->tick = 0;
+    this->dragon_ramp = &EFLedPalette.get(VUMETER_DRAGON_HUE);
+    this->bar_ramp = &EFLedPalette.get(VUMETER_BAR_HUE);
 }
 
 int sMin = 0;
@@ -70,53 +72,53 @@ void VUMeter::run() {
     uint8_t n = map(peakToPeak, 0, 4096, 0, 12);
 
 
-    std::vector<CRGB> dragon = {
+    CRGB dragon[EFLED_DRAGON_NUM] = {
         CRGB::Black,
-        CHSV(0, 255, 40),
-        CHSV(0, 255, 110),
-        CHSV(0, 255, 255),
+        (*this->dragon_ramp)[40],
+        (*this->dragon_ramp)[110],
+        (*this->dragon_ramp)[255],
         CRGB::Black,
         CRGB::Black
     };
 
-    std::vector<CRGB> bar = {
-        CHSV(hue_list[0], 255, (n > 0 ? 0 : 255)),
-        CHSV(hue_list[1], 255, (n > 1 ? 0 : 255)),
-        CHSV(hue_list[2], 255, (n > 2 ? 0 : 255)),
-        CHSV(hue_list[3], 255, (n > 3 ? 0 : 255)),
-        CHSV(hue_list[4], 255, (n > 4 ? 0 : 255)),
-        CHSV(hue_list[5], 255, (n > 5 ? 0 : 255)),
-        CHSV(hue_list[6], 255, (n > 6 ? 0 : 255)),
-        CHSV(hue_list[7], 255, (n > 7 ? 0 : 255)),
-        CHSV(hue_list[8], 255, (n > 8 ? 0 : 255)),
-        CHSV(hue_list[9], 255, (n > 9 ? 0 : 255)),
-        CHSV(hue_list[10], 255, (n > 10 ? 0 : 255)),
+    CRGB bar[EFLED_EFBAR_NUM] = {
+        (*this->bar_ramp)[n > 0 ? 0 : 255],
+        (*this->bar_ramp)[n > 1 ? 0 : 255],
+        (*this->bar_ramp)[n > 2 ? 0 : 255],
+        (*this->bar_ramp)[n > 3 ? 0 : 255],
+        (*this->bar_ramp)[n > 4 ? 0 : 255],
+        (*this->bar_ramp)[n > 5 ? 0 : 255],
+        (*this->bar_ramp)[n > 6 ? 0 : 255],
+        (*this->bar_ramp)[n > 7 ? 0 : 255],
+        (*this->bar_ramp)[n > 8 ? 0 : 255],
+        (*this->bar_ramp)[n > 9 ? 0 : 255],
+        (*this->bar_ramp)[n > 10 ? 0 : 255],
     };
 
     // Calculate current pattern based on tick
-    std::rotate(dragon.begin(), dragon.begin() + this->tick % EFLED_DRAGON_NUM, dragon.end());
-    std::rotate(bar.rbegin(), bar.rbegin() + this->tick % EFLED_EFBAR_NUM, bar.rend());
+    std::rotate(dragon, dragon + this->tick % EFLED_DRAGON_NUM, dragon + EFLED_DRAGON_NUM);
+    std::rotate(bar, bar + EFLED_EFBAR_NUM - this->tick % EFLED_EFBAR_NUM, bar + EFLED_EFBAR_NUM);
 
-    dragon.insert(dragon.end(), bar.begin(), bar.end());
-    EFLed.setAll(dragon.data());
+    EFLed.setDragon(dragon);
+    EFLed.setEFBar(bar);
 
     // Prepare next tick
     this->tick++;
 }
 
-std::unique_ptr<FSMState> VUMeter::touchEventFingerprintShortpress() {
+FSMStatePtr VUMeter::touchEventFingerprintShortpress() {
     if (this->isLocked()) {
         return nullptr;
     }
 
-    return std::make_unique<MenuMain>();
+    return makeState<MenuMain>();
 }
 
-std::unique_ptr<FSMState> VUMeter::touchEventFingerprintLongpress() {
+FSMStatePtr VUMeter::touchEventFingerprintLongpress() {
     return this->touchEventFingerprintShortpress();
 }
 
-std::unique_ptr<FSMState> VUMeter::touchEventFingerprintRelease() {
+FSMStatePtr VUMeter::touchEventFingerprintRelease() {
     if (this->isLocked()) {
         return nullptr;
     }
@@ -128,7 +130,7 @@ std::unique_ptr<FSMState> VUMeter::touchEventFingerprintRelease() {
     return nullptr;
 }
 
-std::unique_ptr<FSMState> VUMeter::touchEventAllLongpress() {
+FSMStatePtr VUMeter::touchEventAllLongpress() {
     this->toggleLock();
     return nullptr;
 }
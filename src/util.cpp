@@ -25,6 +25,7 @@
  */
  
 #include <Arduino.h>
+#include <EFMath.h>
 #include <util.h>
 
 const char* toString(EFBoardPowerState state) {
@@ -46,14 +47,27 @@ const char* toString(EFTouchZone zone) {
     }
 }
 
+const char* toString(FSMEvent event) {
+    switch (event) {
+        case FSMEvent::NoOp:                  return "NoOp";
+        case FSMEvent::AllShortpress:         return "AllShortpress";
+        case FSMEvent::AllLongpress:          return "AllLongpress";
+        case FSMEvent::FingerprintTouch:      return "FingerprintTouch";
+        case FSMEvent::FingerprintRelease:    return "FingerprintRelease";
+        case FSMEvent::FingerprintShortpress: return "FingerprintShortpress";
+        case FSMEvent::FingerprintLongpress:  return "FingerprintLongpress";
+        case FSMEvent::NoseTouch:             return "NoseTouch";
+        case FSMEvent::NoseRelease:           return "NoseRelease";
+        case FSMEvent::NoseShortpress:        return "NoseShortpress";
+        case FSMEvent::NoseLongpress:         return "NoseLongpress";
+        default: return "INVALID";
+    }
+}
+
 /**
  * @brief Calculates a wave animation. Used by bootupAnimation()
  */
-const float wave_function(float x, float start, float end, float amplitude) {
-    if (x < start || x > end) {
-        return 0;
-    }
-    double normalized_x = (x - start) / (end - start) * M_PI;
-    return amplitude * std::sin(normalized_x);
+const uint8_t wave_function(int16_t x, int16_t start, int16_t end, uint8_t amplitude) {
+    return EFMath::halfWave(x, start, end, amplitude);
 }
 
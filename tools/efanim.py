@@ -0,0 +1,193 @@
+#!/usr/bin/python3
+
+# MIT License
+#
+# Copyright 2024 Eurofurence e.V.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the “Software”),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+# Encodes LED animations into the EFAN format (see lib/EFLed/EFLedAnimation.h)
+# and packs them into an image for the "anim" data partition.
+#
+# Input files are JSON:
+#
+#   {
+#     "name": "Sparkle",
+#     "frame_ms": 50,
+#     "frames": [
+#       ["#000000", "#ff0000", ... one color per LED ...],
+#       ...
+#     ]
+#   }
+#
+# Usage:
+#   tools/efanim.py -o anim.bin sparkle.json rainbow.json
+#   esptool.py --chip esp32s3 write_flash 0x610000 anim.bin
+
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x4E414645
+VERSION = 1
+ALIGN = 4
+HEADER = struct.Struct("<IBBHHHI16s")
+MAX_RUN = 64
+
+OP_SKIP = 0x00
+OP_FILL = 0x40
+OP_LITERAL = 0x80
+OP_MASK = 0xC0
+
+
+def parse_color(value):
+    if isinstance(value, str):
+        value = value.lstrip("#")
+        return (int(value[0:2], 16), int(value[2:4], 16), int(value[4:6], 16))
+    return tuple(value)
+
+
+def encode_frame(prev, frame):
+    """Codes frame relative to prev as a list of SKIP/FILL/LITERAL runs."""
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_RUN]
+            del literal[:MAX_RUN]
+            out.append(OP_LITERAL | (len(chunk) - 1))
+            for color in chunk:
+                out.extend(color)
+
+    i = 0
+    while i < len(frame):
+        # Unchanged LEDs
+        j = i
+        while j < len(frame) and j - i < MAX_RUN and frame[j] == prev[j]:
+            j += 1
+        if j - i >= 1 and (j - i >= 2 or not literal):
+            flush_literal()
+            out.append(OP_SKIP | (j - i - 1))
+            i = j
+            continue
+
+        # Runs of the same color
+        j = i
+        while j < len(frame) and j - i < MAX_RUN and frame[j] == frame[i]:
+            j += 1
+        if j - i >= 2:
+            flush_literal()
+            out.append(OP_FILL | (j - i - 1))
+            out.extend(frame[i])
+            i = j
+            continue
+
+        literal.append(frame[i])
+        i += 1
+
+    flush_literal()
+    return bytes(out)
+
+
+def decode(blob):
+    """Decodes a single animation. Returns (name, frame_ms, frames, size)."""
+    magic, version, num_leds, frame_ms, num_frames, _, data_len, name = HEADER.unpack_from(blob)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("not an EFAN v%d animation" % VERSION)
+
+    data = blob[HEADER.size:HEADER.size + data_len]
+    frame = [(0, 0, 0)] * num_leds
+    frames = []
+    pos = 0
+    for _ in range(num_frames):
+        frame = list(frame)
+        led = 0
+        while led < num_leds:
+            op = data[pos] & OP_MASK
+            count = (data[pos] & ~OP_MASK & 0xFF) + 1
+            pos += 1
+            if op == OP_FILL:
+                frame[led:led + count] = [tuple(data[pos:pos + 3])] * count
+                pos += 3
+            elif op == OP_LITERAL:
+                for k in range(count):
+                    frame[led + k] = tuple(data[pos:pos + 3])
+                    pos += 3
+            elif op != OP_SKIP:
+                raise ValueError("invalid opcode 0x%02x" % data[pos - 1])
+            led += count
+        frames.append(frame)
+
+    size = (HEADER.size + data_len + ALIGN - 1) // ALIGN * ALIGN
+    return name.rstrip(b"\0").decode(), frame_ms, frames, size
+
+
+def encode(name, frame_ms, frames):
+    """Encodes a single animation including header and padding."""
+    if not frames:
+        raise ValueError("%s: animation has no frames" % name)
+    num_leds = len(frames[0])
+    if not 0 < num_leds <= 255 or any(len(f) != num_leds for f in frames):
+        raise ValueError("%s: all frames must have the same number of LEDs" % name)
+    if len(frames) > 0xFFFF:
+        raise ValueError("%s: too many frames" % name)
+
+    data = bytearray()
+    prev = [(0, 0, 0)] * num_leds
+    for frame in frames:
+        data.extend(encode_frame(prev, frame))
+        prev = frame
+
+    blob = HEADER.pack(MAGIC, VERSION, num_leds, frame_ms, len(frames), 0, len(data), name.encode()[:16]) + data
+    blob += b"\xff" * (-len(blob) % ALIGN)
+
+    # Verify the round trip before anything is flashed
+    _, _, decoded, _ = decode(blob)
+    if decoded != frames:
+        raise AssertionError("%s: round trip mismatch" % name)
+
+    return blob
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packs LED animations into an EFAN partition image")
+    parser.add_argument("-o", "--output", required=True, help="partition image to write")
+    parser.add_argument("inputs", nargs="+", help="JSON animation files")
+    args = parser.parse_args()
+
+    image = bytearray()
+    for path in args.inputs:
+        with open(path) as f:
+            spec = json.load(f)
+        frames = [[parse_color(c) for c in frame] for frame in spec["frames"]]
+        blob = encode(spec.get("name", path), int(spec.get("frame_ms", 50)), frames)
+        raw = len(frames) * len(frames[0]) * 3
+        print("%s: %d frames, %d bytes (raw %d bytes)" % (path, len(frames), len(blob), raw))
+        image.extend(blob)
+
+    with open(args.output, "wb") as f:
+        f.write(image)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())